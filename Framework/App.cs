@@ -62,6 +62,12 @@ public static class App
 	/// </summary>
 	public static string UserPath { get; private set; } = string.Empty;
 
+	/// <summary>
+	/// The number of multisample antialiasing samples for the Back Buffer, or 0 to disable it.
+	/// This must be assigned before the Application is run.
+	/// </summary>
+	public static int BackbufferSamples { get; set; } = 4;
+
 	/// <summary>
 	/// Returns whether the Application Window is currently Focused or not.
 	/// </summary>
@@ -291,7 +297,7 @@ public static class App
 	public static void Run<T>(string applicationName, int width, int height, bool fullscreen = false, Renderers renderer = Renderers.None) where T : Module, new()
 	{
 		Register<T>();
-		Run(applicationName, width, height, fullscreen);
+		Run(applicationName, width, height, fullscreen, renderer);
 	}
 
 	/// <summary>
@@ -326,6 +332,7 @@ public static class App
 			height = height,
 			renderer = renderer,
 			flags = flags,
+			backbufferSamples = BackbufferSamples,
 		});
 
 		if(Platform.FosterIsRunning() == 0)
@@ -376,6 +383,7 @@ public static class App
 			modules[i].Shutdown();
 		modules.Clear();
 
+		Graphics.Pipelines.DestroyAll();
 		Graphics.Resources.DeleteAllocated();
 		Platform.FosterShutdown();
 		Platform.FreeUTF8(name);
@@ -456,7 +464,7 @@ public static class App
 		for (int i = 0; i < modules.Count; i ++)
 			modules[i].Render();
 
-		Platform.FosterEndFrame();
+		Graphics.EndFrame();
 	}
 
 	private static void PollEvents()
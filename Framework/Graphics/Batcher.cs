@@ -26,21 +26,79 @@ public class Batcher : IDisposable
 		public Vector2 Pos = position;
 		public Vector2 Tex = texcoord;
 		public Color Col = color;
-		public Color Mode = mode;  // R = Multiply, G = Wash, B = Fill, A = Padding
+		public Color Mode = mode;  // R = Multiply, G = Wash, B = Fill, A = Texture Slot (or Layer, for Texture Arrays)
 
 		public readonly VertexFormat Format => VertexFormat;
 	}
 
+	/// <summary>
+	/// Vertex Format of the unit quad each Sprite Instance is expanded from
+	/// </summary>
+	private static readonly VertexFormat CornerFormat = VertexFormat.Create<Vector2>(
+		new VertexFormat.Element(0, VertexType.Float2, false)
+	);
+
+	/// <summary>
+	/// Instance Format of Batcher.Instance
+	/// </summary>
+	private static readonly VertexFormat InstanceFormat = VertexFormat.Create<Instance>(
+		new VertexFormat.Element(1, VertexType.Float2, false),
+		new VertexFormat.Element(2, VertexType.Float2, false),
+		new VertexFormat.Element(3, VertexType.Float2, false),
+		new VertexFormat.Element(4, VertexType.Float4, false),
+		new VertexFormat.Element(5, VertexType.UByte4, true),
+		new VertexFormat.Element(6, VertexType.UByte4, true)
+	);
+
+	/// <summary>
+	/// A single Sprite when <see cref="Instancing"/> is enabled, which the
+	/// Vertex Shader expands into a quad spanning Pos + AxisX + AxisY
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	private struct Instance
+	{
+		public Vector2 Pos;
+		public Vector2 AxisX;
+		public Vector2 AxisY;
+		public Vector4 Tex; // XY = top-left, ZW = bottom-right
+		public Color Col;
+		public Color Mode;
+	}
+
+	/// <summary>
+	/// The number of Textures the default Material can draw in a single batch.
+	/// Must match the size of the u_texture array in the default Batcher shader.
+	/// </summary>
+	private const int MaxBatchTextures = 8;
+
 	/// <summary>
 	/// The Default shader used by the Batcher.
 	/// </summary>
 	private static Shader? DefaultShader;
 
+	/// <summary>
+	/// The Default shader used by the Batcher for Sprite Instances.
+	/// </summary>
+	private static Shader? DefaultInstancedShader;
+
+	/// <summary>
+	/// The Default shader used by the Batcher for Texture Arrays.
+	/// </summary>
+	private static Shader? DefaultArrayShader;
+
 	/// <summary>
 	/// The current Matrix Value of the Batcher
 	/// </summary>
 	public Matrix3x2 Matrix = Matrix3x2.Identity;
 
+	/// <summary>
+	/// If Quads and Images drawn with the default Material are sent to the GPU as a single
+	/// compact Instance each, instead of as 4 Vertices and 6 Indices. This greatly reduces
+	/// the data uploaded for sprite-heavy scenes. Any other shapes, and anything drawn
+	/// with a custom Material, are still drawn from Vertices in the same order.
+	/// </summary>
+	public bool Instancing = false;
+
 	/// <summary>
 	/// The current Scissor Value of the Batcher
 	/// </summary>
@@ -61,6 +119,11 @@ public class Batcher : IDisposable
 	/// </summary>
 	public int IndexCount => indexCount;
 
+	/// <summary>
+	/// The number of Sprite Instances in the Batcher to be drawn
+	/// </summary>
+	public int InstanceCount => instanceCount;
+
 	/// <summary>
 	/// The number of individual batches (draw calls).
 	/// </summary>
@@ -76,11 +139,19 @@ public class Batcher : IDisposable
 	private readonly Stack<int> layerStack = new();
 	private readonly Stack<Color> modeStack = new();
 	private readonly List<Batch> batches = new();
-	private readonly Mesh mesh = new();
+	private readonly Mesh mesh = new(MeshUsage.Stream);
+	private Mesh? instanceMesh;
+	private readonly Material instancedMaterial = new();
+	private readonly Material arrayMaterial = new();
 	private Batch currentBatch;
 	private int currentBatchInsert;
 	private Color mode = new(255, 0, 0, 0);
+	private int textureLayer;
+	private int textureSlot;
 	private bool dirty;
+	private bool instancesDirty;
+	private Renderers instancingRenderer = Renderers.None;
+	private bool instancingSupported;
 
 	private readonly List<Material> materialPool = new();
 	private int materialPoolIndex;
@@ -93,6 +164,10 @@ public class Batcher : IDisposable
 	private int indexCount = 0;
 	private int indexCapacity = 0;
 
+	private IntPtr instancePtr = IntPtr.Zero;
+	private int instanceCount = 0;
+	private int instanceCapacity = 0;
+
 	private readonly record struct MaterialState(
 		Material Material,
 		string MatrixUniform,
@@ -110,7 +185,20 @@ public class Batcher : IDisposable
 		public TextureSampler Sampler = sampler;
 		public int Offset = offset;
 		public int Elements = elements;
+		public bool Instanced = false;
 		public bool FlipVerticalUV = (texture?.IsTargetAttachment ?? false) && Graphics.OriginBottomLeft;
+		public BatchTextures Textures = default;
+		public int TextureCount = 0;
+	}
+
+	/// <summary>
+	/// The Textures bound for a batch drawn with the default Material,
+	/// which each Vertex selects from with its Mode's alpha
+	/// </summary>
+	[InlineArray(MaxBatchTextures)]
+	private struct BatchTextures
+	{
+		private Texture? element;
 	}
 
 	public Batcher()
@@ -140,6 +228,13 @@ public class Batcher : IDisposable
 			indexCapacity = 0;
 		}
 
+		if (instancePtr != IntPtr.Zero)
+		{
+			Marshal.FreeHGlobal(instancePtr);
+			instancePtr = IntPtr.Zero;
+			instanceCapacity = 0;
+		}
+
 		materialPool.Clear();
 		materialPoolIndex = 0;
 	}
@@ -151,10 +246,13 @@ public class Batcher : IDisposable
 	{
 		vertexCount = 0;
 		indexCount = 0;
+		instanceCount = 0;
 		currentBatchInsert = 0;
 		materialPoolIndex = 0;
 		currentBatch = new Batch(defaultMaterialState, BlendMode.Premultiply, null, new(), 0, 0);
+		ResetTextureSlots(null);
 		mode = new Color(255, 0, 0, 0);
+		textureLayer = 0;
 		batches.Clear();
 		matrixStack.Clear();
 		scissorStack.Clear();
@@ -201,25 +299,47 @@ public class Batcher : IDisposable
 		if (target != null && target.IsDisposed)
 			throw new Exception("Target is disposed");
 
-		if (indexPtr == IntPtr.Zero || vertexPtr == IntPtr.Zero)
-			return;
-
 		if (batches.Count <= 0 && currentBatch.Elements <= 0)
 			return;
 
-		// upload our data if we've been modified since the last time we rendered
-		if (dirty)
+		// upload our data if we've been modified since the last time we rendered,
+		// using transient memory when there's room so nothing queued has to be flushed
+		if (indexCount > 0 && (dirty || mesh.IsTransientExpired))
 		{
-			mesh.SetIndices(indexPtr, indexCount, IndexFormat.ThirtyTwo);
-			mesh.SetVertices(vertexPtr, vertexCount, VertexFormat);
+			if (!mesh.SetTransient(vertexPtr, vertexCount, VertexFormat, indexPtr, indexCount, IndexFormat.ThirtyTwo))
+			{
+				mesh.SetIndices(indexPtr, indexCount, IndexFormat.ThirtyTwo);
+				mesh.SetVertices(vertexPtr, vertexCount, VertexFormat);
+			}
 			dirty = false;
 		}
 
+		// upload sprite instances, which are drawn from a shared unit quad
+		if (instanceCount > 0 && instancesDirty)
+		{
+			if (instanceMesh == null)
+			{
+				instanceMesh = new(MeshUsage.Stream);
+				instanceMesh.SetVertices<Vector2>([new(0, 0), new(1, 0), new(1, 1), new(0, 1)], CornerFormat);
+				instanceMesh.SetIndices<int>([0, 1, 2, 0, 2, 3]);
+			}
+
+			instanceMesh.SetInstances(instancePtr, instanceCount, InstanceFormat);
+			instancesDirty = false;
+		}
+
 		// make sure default shader and material are valid
 		if (DefaultShader == null || DefaultShader.IsDisposed)
 			DefaultShader = new Shader(ShaderDefaults.Batcher[Graphics.Renderer]);
 		defaultMaterial.SetShader(DefaultShader);
 
+		if (instanceCount > 0)
+		{
+			if (DefaultInstancedShader == null || DefaultInstancedShader.IsDisposed)
+				DefaultInstancedShader = new Shader(ShaderDefaults.BatcherInstanced[Graphics.Renderer]);
+			instancedMaterial.SetShader(DefaultInstancedShader);
+		}
+
 		// render batches
 		for (int i = 0; i < batches.Count; i++)
 		{
@@ -246,10 +366,36 @@ public class Batcher : IDisposable
 
 		var texture = batch.Texture != null && !batch.Texture.IsDisposed ? batch.Texture : null;
 
-		var mat = batch.MaterialState.Material;
-		mat.Set(batch.MaterialState.MatrixUniform, matrix);
-		mat.Set(batch.MaterialState.TextureUniform, texture);
-		mat.Set(batch.MaterialState.SamplerUniform, batch.Sampler);
+		// instanced batches are only ever made with the default material
+		var state = batch.Instanced ? defaultMaterialState with { Material = instancedMaterial } : batch.MaterialState;
+
+		// the default material samples Texture Arrays with a separate shader
+		if (state.Material == defaultMaterial && texture != null && texture.IsArray)
+		{
+			if (DefaultArrayShader == null || DefaultArrayShader.IsDisposed)
+				DefaultArrayShader = new Shader(ShaderDefaults.BatcherArray[Graphics.Renderer]);
+			arrayMaterial.SetShader(DefaultArrayShader);
+			state = defaultMaterialState with { Material = arrayMaterial };
+		}
+
+		var mat = state.Material;
+		mat.Set(state.MatrixUniform, matrix);
+
+		// the default material binds every Texture used in the batch
+		if (mat == defaultMaterial)
+		{
+			for (int i = 0; i < MaxBatchTextures; i++)
+			{
+				var it = i < batch.TextureCount ? batch.Textures[i] : null;
+				mat.Set(state.TextureUniform, it != null && !it.IsDisposed ? it : null, i);
+				mat.Set(state.SamplerUniform, batch.Sampler, i);
+			}
+		}
+		else
+		{
+			mat.Set(state.TextureUniform, texture);
+			mat.Set(state.SamplerUniform, batch.Sampler);
+		}
 
 		DrawCommand command = new(target, mesh, mat)
 		{
@@ -262,6 +408,16 @@ public class Batcher : IDisposable
 			DepthCompare = DepthCompare.None,
 			CullMode = CullMode.None
 		};
+
+		if (batch.Instanced && instanceMesh != null)
+		{
+			command.Mesh = instanceMesh;
+			command.MeshIndexStart = 0;
+			command.MeshIndexCount = 6;
+			command.InstanceStart = batch.Offset;
+			command.InstanceCount = batch.Elements;
+		}
+
 		command.Submit();
 	}
 
@@ -273,22 +429,90 @@ public class Batcher : IDisposable
 	/// Sets the Current Texture being drawn
 	/// </summary>
 	public void SetTexture(Texture? texture)
+		=> SetTexture(texture, 0);
+
+	/// <summary>
+	/// Sets the Current Texture being drawn, and the Layer to draw from if it's a Texture Array.
+	/// Changing Layers doesn't break the batch, so sprites from many same-sized sheets
+	/// can be drawn together by putting them in the Layers of one Texture Array.
+	/// </summary>
+	public void SetTexture(Texture? texture, int layer)
 	{
-		if (currentBatch.Texture == null || currentBatch.Elements == 0)
+		if (texture != null && texture.IsArray && (layer < 0 || layer >= Math.Min(texture.Layers, 256)))
+			throw new ArgumentOutOfRangeException(nameof(layer), "Layer is out of range of the Texture Array, which the Batcher can only draw the first 256 Layers of");
+
+		textureLayer = layer;
+
+		if (currentBatch.Texture == texture)
+			return;
+
+		int slot;
+
+		// the instanced shader can't sample Texture Arrays, so they're drawn in a new vertex batch
+		if (currentBatch.Instanced && texture != null && texture.IsArray)
+			SetInstanced(false);
+
+		// nothing drawn so far needs the previous Textures
+		if (currentBatch.Elements == 0)
+		{
+			ResetTextureSlots(texture);
+		}
+		// only untextured shapes have been drawn, which don't care what's bound
+		else if (currentBatch.Texture == null && currentBatch.TextureCount <= 1)
+		{
+			currentBatch.Textures[textureSlot] = texture;
+		}
+		// the default material can draw several Textures in one batch
+		else if (CanShareTextures(texture) && (slot = FindTextureSlot(texture)) >= 0)
 		{
-			currentBatch.Texture = texture;
-			currentBatch.FlipVerticalUV = (texture?.IsTargetAttachment ?? false) && Graphics.OriginBottomLeft;
+			textureSlot = slot;
 		}
-		else if (currentBatch.Texture != texture)
+		else if (CanShareTextures(texture) && currentBatch.TextureCount < MaxBatchTextures)
+		{
+			textureSlot = currentBatch.TextureCount;
+			currentBatch.Textures[currentBatch.TextureCount++] = texture;
+		}
+		else
 		{
 			batches.Insert(currentBatchInsert, currentBatch);
 
-			currentBatch.Texture = texture;
-			currentBatch.FlipVerticalUV = (texture?.IsTargetAttachment ?? false) && Graphics.OriginBottomLeft;
+			ResetTextureSlots(texture);
 			currentBatch.Offset += currentBatch.Elements;
 			currentBatch.Elements = 0;
 			currentBatchInsert++;
 		}
+
+		currentBatch.Texture = texture;
+		currentBatch.FlipVerticalUV = (texture?.IsTargetAttachment ?? false) && Graphics.OriginBottomLeft;
+	}
+
+	/// <summary>
+	/// If the current batch can bind the given Texture alongside the ones it already uses.
+	/// Only the default Material's Vertex path does, and not for Texture Arrays.
+	/// </summary>
+	private bool CanShareTextures(Texture? texture)
+	{
+		return
+			currentBatch.MaterialState.Material == defaultMaterial &&
+			!currentBatch.Instanced &&
+			(texture == null || !texture.IsArray) &&
+			(currentBatch.Texture == null || !currentBatch.Texture.IsArray);
+	}
+
+	private int FindTextureSlot(Texture? texture)
+	{
+		for (int i = 0; i < currentBatch.TextureCount; i++)
+			if (currentBatch.Textures[i] == texture)
+				return i;
+		return -1;
+	}
+
+	private void ResetTextureSlots(Texture? texture)
+	{
+		currentBatch.Textures = default;
+		currentBatch.Textures[0] = texture;
+		currentBatch.TextureCount = 1;
+		textureSlot = 0;
 	}
 
 	/// <summary>
@@ -664,6 +888,9 @@ public class Batcher : IDisposable
 
 	public void Quad(in Vector2 v0, in Vector2 v1, in Vector2 v2, in Vector2 v3, in Color color)
 	{
+		if (Instancing && TryPushInstance(v0, v1, v2, v3, default, default, default, default, color, new Color(0, 0, 255, 0)))
+			return;
+
 		PushQuad();
 		EnsureVertexCapacity(vertexCount + 4);
 
@@ -691,12 +918,16 @@ public class Batcher : IDisposable
 
 	public void Quad(in Vector2 v0, in Vector2 v1, in Vector2 v2, in Vector2 v3, in Vector2 t0, in Vector2 t1, in Vector2 t2, in Vector2 t3, in Color color)
 	{
+		if (Instancing && TryPushInstance(v0, v1, v2, v3, t0, t1, t2, t3, color, mode))
+			return;
+
 		PushQuad();
 		EnsureVertexCapacity(vertexCount + 4);
 
 		unsafe
 		{
 			var vertexArray = new Span<Vertex>((Vertex*)vertexPtr + vertexCount, 4);
+			var vertexMode = VertexMode;
 
 			vertexArray[0].Pos = Vector2.Transform(v0, Matrix);
 			vertexArray[1].Pos = Vector2.Transform(v1, Matrix);
@@ -710,10 +941,10 @@ public class Batcher : IDisposable
 			vertexArray[1].Col = color;
 			vertexArray[2].Col = color;
 			vertexArray[3].Col = color;
-			vertexArray[0].Mode = mode;
-			vertexArray[1].Mode = mode;
-			vertexArray[2].Mode = mode;
-			vertexArray[3].Mode = mode;
+			vertexArray[0].Mode = vertexMode;
+			vertexArray[1].Mode = vertexMode;
+			vertexArray[2].Mode = vertexMode;
+			vertexArray[3].Mode = vertexMode;
 
 			if (currentBatch.FlipVerticalUV)
 				FlipVerticalUVs(vertexPtr, vertexCount, 4);
@@ -757,6 +988,7 @@ public class Batcher : IDisposable
 		unsafe
 		{
 			var vertexArray = new Span<Vertex>((Vertex*)vertexPtr + vertexCount, 4);
+			var vertexMode = VertexMode;
 
 			vertexArray[0].Pos = Vector2.Transform(v0, Matrix);
 			vertexArray[1].Pos = Vector2.Transform(v1, Matrix);
@@ -770,10 +1002,10 @@ public class Batcher : IDisposable
 			vertexArray[1].Col = c1;
 			vertexArray[2].Col = c2;
 			vertexArray[3].Col = c3;
-			vertexArray[0].Mode = mode;
-			vertexArray[1].Mode = mode;
-			vertexArray[2].Mode = mode;
-			vertexArray[3].Mode = mode;
+			vertexArray[0].Mode = vertexMode;
+			vertexArray[1].Mode = vertexMode;
+			vertexArray[2].Mode = vertexMode;
+			vertexArray[3].Mode = vertexMode;
 
 			if (currentBatch.FlipVerticalUV)
 				FlipVerticalUVs(vertexPtr, vertexCount, 4);
@@ -830,6 +1062,7 @@ public class Batcher : IDisposable
 		unsafe
 		{
 			var vertexArray = new Span<Vertex>((Vertex*)vertexPtr + vertexCount, 3);
+			var vertexMode = VertexMode;
 
 			vertexArray[0].Pos = Vector2.Transform(v0, Matrix);
 			vertexArray[1].Pos = Vector2.Transform(v1, Matrix);
@@ -840,9 +1073,9 @@ public class Batcher : IDisposable
 			vertexArray[0].Col = color;
 			vertexArray[1].Col = color;
 			vertexArray[2].Col = color;
-			vertexArray[0].Mode = mode;
-			vertexArray[1].Mode = mode;
-			vertexArray[2].Mode = mode;
+			vertexArray[0].Mode = vertexMode;
+			vertexArray[1].Mode = vertexMode;
+			vertexArray[2].Mode = vertexMode;
 
 			if (currentBatch.FlipVerticalUV)
 				FlipVerticalUVs(vertexPtr, vertexCount, 3);
@@ -1026,6 +1259,9 @@ public class Batcher : IDisposable
 			var r3_br = r3_tl + new Vector2(r3, r3);
 
 			// set tris
+			if (currentBatch.Instanced)
+				SetInstanced(false);
+
 			unsafe
 			{
 				EnsureIndexCapacity(indexCount + 30);
@@ -1478,7 +1714,7 @@ public class Batcher : IDisposable
 
 	public void Image(in Subtexture subtex, Color color)
 	{
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			subtex.DrawCoords0, subtex.DrawCoords1, subtex.DrawCoords2, subtex.DrawCoords3,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1487,7 +1723,7 @@ public class Batcher : IDisposable
 
 	public void Image(in Subtexture subtex, in Vector2 position, Color color)
 	{
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(position + subtex.DrawCoords0, position + subtex.DrawCoords1, position + subtex.DrawCoords2, position + subtex.DrawCoords3,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
 			color);
@@ -1499,7 +1735,7 @@ public class Batcher : IDisposable
 
 		Matrix = Transform.CreateMatrix(position, origin, scale, rotation) * Matrix;
 
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			subtex.DrawCoords0, subtex.DrawCoords1, subtex.DrawCoords2, subtex.DrawCoords3,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1514,7 +1750,7 @@ public class Batcher : IDisposable
 
 		Matrix = Transform.CreateMatrix(position, origin, scale, rotation) * Matrix;
 
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			subtex.DrawCoords0, subtex.DrawCoords1, subtex.DrawCoords2, subtex.DrawCoords3,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1549,7 +1785,7 @@ public class Batcher : IDisposable
 			ty1 = source.Bottom / tex.Height;
 		}
 
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			new Vector2(px0, py0), new Vector2(px1, py0), new Vector2(px1, py1), new Vector2(px0, py1),
 			new Vector2(tx0, ty0), new Vector2(tx1, ty0), new Vector2(tx1, ty1), new Vector2(tx0, ty1),
@@ -1560,7 +1796,7 @@ public class Batcher : IDisposable
 
 	public void ImageStretch(in Subtexture subtex, in Rect rect, Color color)
 	{
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			rect.TopLeft, rect.TopRight, rect.BottomRight, rect.BottomLeft,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1574,7 +1810,7 @@ public class Batcher : IDisposable
 		var pos = rect.Position;
 		Matrix = Transform.CreateMatrix(pos, origin, scale, rotation) * Matrix;
 
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			Vector2.Zero, rect.TopRight - pos, rect.BottomRight - pos, rect.BottomLeft - pos,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1585,7 +1821,7 @@ public class Batcher : IDisposable
 
 	public void ImageStretch(in Subtexture subtex, in Rect rect, Color c0, Color c1, Color c2, Color c3)
 	{
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			rect.TopLeft, rect.TopRight, rect.BottomRight, rect.BottomLeft,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1599,7 +1835,7 @@ public class Batcher : IDisposable
 		var pos = rect.Position;
 		Matrix = Transform.CreateMatrix(pos, origin, scale, rotation) * Matrix;
 
-		SetTexture(subtex.Texture);
+		SetTexture(subtex.Texture, subtex.TextureLayer);
 		Quad(
 			Vector2.Zero, rect.TopRight - pos, rect.BottomRight - pos, rect.BottomLeft - pos,
 			subtex.TexCoords0, subtex.TexCoords1, subtex.TexCoords2, subtex.TexCoords3,
@@ -1681,6 +1917,9 @@ public class Batcher : IDisposable
 	[MethodImpl(MethodImplOptions.AggressiveInlining)]
 	private void PushTriangle()
 	{
+		if (currentBatch.Instanced)
+			SetInstanced(false);
+
 		EnsureIndexCapacity(indexCount + 3);
 
 		unsafe
@@ -1700,6 +1939,9 @@ public class Batcher : IDisposable
 	[MethodImpl(MethodImplOptions.AggressiveInlining)]
 	private void PushQuad()
 	{
+		if (currentBatch.Instanced)
+			SetInstanced(false);
+
 		EnsureIndexCapacity(indexCount + 6);
 
 		unsafe
@@ -1719,6 +1961,114 @@ public class Batcher : IDisposable
 		dirty = true;
 	}
 
+	/// <summary>
+	/// Starts a new batch if switching between Vertices and Instances, as they're drawn separately.
+	/// The batch's Offset and Elements then count Instances instead of Triangles.
+	/// </summary>
+	private void SetInstanced(bool instanced)
+	{
+		if (currentBatch.Instanced == instanced)
+			return;
+
+		if (currentBatch.Elements > 0)
+		{
+			batches.Insert(currentBatchInsert, currentBatch);
+			currentBatchInsert++;
+		}
+
+		currentBatch.Instanced = instanced;
+		currentBatch.Offset = instanced ? instanceCount : indexCount / 3;
+		currentBatch.Elements = 0;
+	}
+
+	/// <summary>
+	/// The current Mode, with the Texture Layer in its alpha when drawing a Texture Array,
+	/// or the Texture Slot when drawing with the default Material. Other Materials only
+	/// have the current Texture bound, in the first slot.
+	/// </summary>
+	private Color VertexMode
+	{
+		get
+		{
+			if (currentBatch.Texture != null && currentBatch.Texture.IsArray)
+				return new Color(mode.R, mode.G, mode.B, (byte)textureLayer);
+			if (currentBatch.MaterialState.Material == defaultMaterial)
+				return new Color(mode.R, mode.G, mode.B, (byte)textureSlot);
+			return new Color(mode.R, mode.G, mode.B, 0);
+		}
+	}
+
+	/// <summary>
+	/// Pushes a Quad as a single Instance, if it's a parallelogram with an axis-aligned
+	/// texture rectangle being drawn with the default Material
+	/// </summary>
+	private bool TryPushInstance(in Vector2 v0, in Vector2 v1, in Vector2 v2, in Vector2 v3, in Vector2 t0, in Vector2 t1, in Vector2 t2, in Vector2 t3, in Color color, in Color mode)
+	{
+		if (instancingRenderer != Graphics.Renderer)
+		{
+			instancingRenderer = Graphics.Renderer;
+			instancingSupported = ShaderDefaults.BatcherInstanced.ContainsKey(instancingRenderer);
+		}
+
+		if (!instancingSupported || currentBatch.MaterialState.Material != defaultMaterial)
+			return false;
+
+		// the instanced shader only samples regular textures
+		if (currentBatch.Texture != null && currentBatch.Texture.IsArray)
+			return false;
+
+		var skew = v0 + v2 - v1 - v3;
+		if (MathF.Abs(skew.X) > 0.01f || MathF.Abs(skew.Y) > 0.01f)
+			return false;
+
+		if (t0.Y != t1.Y || t3.Y != t2.Y || t0.X != t3.X || t1.X != t2.X)
+			return false;
+
+		SetInstanced(true);
+		EnsureInstanceCapacity(instanceCount + 1);
+
+		unsafe
+		{
+			var it = (Instance*)instancePtr + instanceCount;
+			it->Pos = Vector2.Transform(v0, Matrix);
+			it->AxisX = Vector2.TransformNormal(v1 - v0, Matrix);
+			it->AxisY = Vector2.TransformNormal(v3 - v0, Matrix);
+			it->Tex = currentBatch.FlipVerticalUV
+				? new Vector4(t0.X, 1.0f - t0.Y, t2.X, 1.0f - t2.Y)
+				: new Vector4(t0.X, t0.Y, t2.X, t2.Y);
+			it->Col = color;
+			it->Mode = mode;
+		}
+
+		instanceCount++;
+		currentBatch.Elements++;
+		instancesDirty = true;
+		return true;
+	}
+
+	[MethodImpl(MethodImplOptions.AggressiveInlining)]
+	private unsafe void EnsureInstanceCapacity(int index)
+	{
+		if (index >= instanceCapacity)
+		{
+			if (instanceCapacity == 0)
+				instanceCapacity = 32;
+
+			while (index >= instanceCapacity)
+				instanceCapacity *= 2;
+
+			var newPtr = Marshal.AllocHGlobal(sizeof(Instance) * instanceCapacity);
+
+			if (instanceCount > 0)
+				Buffer.MemoryCopy((void*)instancePtr, (void*)newPtr, instanceCapacity * sizeof(Instance), instanceCount * sizeof(Instance));
+
+			if (instancePtr != IntPtr.Zero)
+				Marshal.FreeHGlobal(instancePtr);
+
+			instancePtr = newPtr;
+		}
+	}
+
 	[MethodImpl(MethodImplOptions.AggressiveInlining)]
 	private unsafe void EnsureIndexCapacity(int index)
 	{
@@ -28,6 +28,29 @@ public struct DrawCommand()
 	/// </summary>
 	public int MeshIndexCount;
 
+	/// <summary>
+	/// A value added to every Index before fetching its Vertex from the Mesh
+	/// </summary>
+	public int BaseVertex = 0;
+
+	/// <summary>
+	/// Optional list of Index ranges to draw with the same state, in a single call.
+	/// If assigned, these are drawn instead of <see cref="MeshIndexStart"/>,
+	/// <see cref="MeshIndexCount"/> and <see cref="BaseVertex"/>.
+	/// </summary>
+	public DrawRange[]? Ranges = null;
+
+	/// <summary>
+	/// The number of Instances to draw, using the Mesh's Instance data.
+	/// If 0, the Mesh is drawn once without instancing.
+	/// </summary>
+	public int InstanceCount = 0;
+
+	/// <summary>
+	/// The first Instance to draw from the Mesh's Instance data
+	/// </summary>
+	public int InstanceStart = 0;
+
 	/// <summary>
 	/// The Render State Blend Mode
 	/// </summary>
@@ -58,6 +81,23 @@ public struct DrawCommand()
 	/// </summary>
 	public RectInt? Scissor = null;
 
+	/// <summary>
+	/// When <see cref="Graphics.SortDraws"/> is enabled, lower Layers are drawn first
+	/// </summary>
+	public int Layer = 0;
+
+	/// <summary>
+	/// When <see cref="Graphics.SortDraws"/> is enabled, opaque draws are sorted
+	/// front to back by this distance, and blended draws back to front
+	/// </summary>
+	public float SortDepth = 0;
+
+	/// <summary>
+	/// When <see cref="Graphics.SortDraws"/> is enabled, prevents this draw from
+	/// being sorted ahead of anything submitted before it
+	/// </summary>
+	public bool SortBarrier = false;
+
 	/// <summary>
 	/// Creates a Draw Command based on the given mesh and material
 	/// </summary>
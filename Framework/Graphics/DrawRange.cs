@@ -0,0 +1,16 @@
+using System.Runtime.InteropServices;
+
+namespace Foster.Framework;
+
+/// <summary>
+/// A range of Mesh Indices to draw, as part of a single Draw Command
+/// </summary>
+/// <param name="IndexStart">The Index to begin rendering from the Mesh</param>
+/// <param name="IndexCount">The total number of Indices to draw from the Mesh</param>
+/// <param name="BaseVertex">A value added to every Index before fetching its Vertex</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct DrawRange(
+	int IndexStart,
+	int IndexCount,
+	int BaseVertex = 0
+);
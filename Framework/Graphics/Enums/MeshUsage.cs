@@ -0,0 +1,22 @@
+namespace Foster.Framework;
+
+/// <summary>
+/// How often a Mesh's data is expected to change, which determines how its buffers are allocated
+/// </summary>
+public enum MeshUsage
+{
+	/// <summary>
+	/// Uploaded once and drawn many times
+	/// </summary>
+	Static,
+
+	/// <summary>
+	/// Updated occasionally
+	/// </summary>
+	Dynamic,
+
+	/// <summary>
+	/// Rewritten every frame or so
+	/// </summary>
+	Stream,
+}
@@ -5,4 +5,11 @@ public enum Renderers
 	None = 0,
 	D3D11,
 	OpenGL,
+
+	/// <summary>
+	/// Headless Renderer that validates and counts Draw Commands without rasterizing them.
+	/// Resources are kept in CPU memory, and no GPU or display is required.
+	/// Shaders are expected in the same GLSL as the OpenGL Renderer.
+	/// </summary>
+	Null,
 }
@@ -4,4 +4,9 @@ public enum TextureFilter
 {
 	Nearest,
 	Linear,
+
+	/// <summary>
+	/// Linear filtering within and between mip levels (trilinear filtering)
+	/// </summary>
+	LinearMipmapLinear,
 }
@@ -17,6 +17,36 @@ public enum TextureFormat
 	/// </summary>
 	Depth24Stencil8,
 
+	/// <summary>
+	/// Red = 8, Green = 8
+	/// </summary>
+	R8G8,
+
+	/// <summary>
+	/// Red = 16 bit float
+	/// </summary>
+	R16F,
+
+	/// <summary>
+	/// Red = 16 bit float, Green = 16 bit float, Blue = 16 bit float, Alpha = 16 bit float
+	/// </summary>
+	R16G16B16A16F,
+
+	/// <summary>
+	/// Red = 32 bit float
+	/// </summary>
+	R32F,
+
+	/// <summary>
+	/// Depth = 16
+	/// </summary>
+	Depth16,
+
+	/// <summary>
+	/// Depth = 32 bit float
+	/// </summary>
+	Depth32F,
+
 	/// <summary>
 	/// Shorthand for R8G8B8A8
 	/// </summary>
@@ -31,6 +61,12 @@ public static class TextureFormatExt
 			TextureFormat.R8G8B8A8 => 4,
 			TextureFormat.R8 => 1,
 			TextureFormat.Depth24Stencil8 => 4,
+			TextureFormat.R8G8 => 2,
+			TextureFormat.R16F => 2,
+			TextureFormat.R16G16B16A16F => 8,
+			TextureFormat.R32F => 4,
+			TextureFormat.Depth16 => 2,
+			TextureFormat.Depth32F => 4,
 			_ => throw new NotImplementedException()
 		};
 }
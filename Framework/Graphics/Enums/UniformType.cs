@@ -10,5 +10,6 @@ public enum UniformType
 	Mat3x2,
 	Mat4x4,
 	Texture2D,
-	Sampler2D
+	Sampler2D,
+	Texture2DArray
 }
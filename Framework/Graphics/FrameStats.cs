@@ -0,0 +1,32 @@
+using System.Runtime.InteropServices;
+
+namespace Foster.Framework;
+
+/// <summary>
+/// Counters for the work the Renderer performed over a frame
+/// </summary>
+/// <param name="DrawCommands">The number of Draw Commands submitted</param>
+/// <param name="DrawCalls">The number of draw calls issued to the Renderer, which can be more than the Draw Commands when ranges aren't merged</param>
+/// <param name="Triangles">The number of Triangles drawn, including every Instance</param>
+/// <param name="Clears">The number of Targets or buffers cleared</param>
+/// <param name="StateChanges">The number of blend, depth, cull, viewport, scissor and vertex array changes</param>
+/// <param name="ProgramBinds">The number of times a different Shader was bound</param>
+/// <param name="TextureBinds">The number of times a different Texture was bound</param>
+/// <param name="SamplerBinds">The number of times a different Sampler was bound</param>
+/// <param name="FramebufferBinds">The number of times a different Target was bound</param>
+/// <param name="BufferUploadBytes">Bytes of Mesh, transient and Uniform data uploaded</param>
+/// <param name="TextureUploadBytes">Bytes of Texture data uploaded</param>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct FrameStats(
+	int DrawCommands,
+	int DrawCalls,
+	int Triangles,
+	int Clears,
+	int StateChanges,
+	int ProgramBinds,
+	int TextureBinds,
+	int SamplerBinds,
+	int FramebufferBinds,
+	int BufferUploadBytes,
+	int TextureUploadBytes
+);
@@ -1,5 +1,6 @@
 
 using System.Diagnostics;
+using System.Runtime.InteropServices;
 
 namespace Foster.Framework
 {
@@ -25,11 +26,70 @@ namespace Foster.Framework
 		/// </summary>
 		public static int MaxTextureSize { get; private set; }
 
+		/// <summary>
+		/// Limits how many bytes of <see cref="Texture.SetDataAsync{T}(in RectInt, ReadOnlySpan{T}, int)"/>
+		/// uploads are performed each frame, spreading the rest over later frames. 0 means no limit.
+		/// </summary>
+		public static int UploadBudget
+		{
+			get => uploadBudget;
+			set
+			{
+				uploadBudget = Math.Max(0, value);
+				Platform.FosterSetUploadBudget(uploadBudget);
+			}
+		}
+		private static int uploadBudget = 0;
+
+		/// <summary>
+		/// Bytes of asynchronous Texture uploads still waiting for a later frame
+		/// </summary>
+		public static int PendingUploadSize => Platform.FosterGetPendingUploadSize() + Uploads.QueuedSize;
+
+		/// <summary>
+		/// The Renderer's counters for the last completed frame
+		/// </summary>
+		public static FrameStats Stats { get; private set; }
+
+		/// <summary>
+		/// If enabled, queued draws are sorted on Flush to reduce state changes.
+		/// Draws sort by <see cref="DrawCommand.Layer"/>, then opaque before blended,
+		/// then by Shader and Texture for opaque draws, or back to front for blended ones.
+		/// Draws are never reordered across a Clear, a change of Target, or a
+		/// <see cref="DrawCommand.SortBarrier"/>, and otherwise equal draws keep their order.
+		/// </summary>
+		public static bool SortDraws { get; set; } = false;
+
 		/// <summary>
 		/// If our (0,0) in our coordinate system is bottom-left.
-		/// This is true in OpenGL
+		/// This is true in OpenGL, and the Null Renderer matches it
+		/// </summary>
+		public static bool OriginBottomLeft => Renderer == Renderers.OpenGL || Renderer == Renderers.Null;
+
+		/// <summary>
+		/// Commands queued by Clear and Submit, waiting to be sent to the Platform
+		/// </summary>
+		private static Platform.FosterCommand[] commands = new Platform.FosterCommand[64];
+		private static int commandCount = 0;
+
+		/// <summary>
+		/// Unmanaged memory holding the Uniform values of queued commands.
+		/// Blocks are reused after every Flush, and never moved while commands reference them.
+		/// </summary>
+		private static readonly List<(nint Ptr, int Size)> commandMemory = new();
+		private static int commandMemoryBlock = 0;
+		private static int commandMemoryOffset = 0;
+		private const int CommandMemoryBlockSize = 64 * 1024;
+
+		/// <summary>
+		/// Incremented on every Flush, invalidating anything copied into command memory
+		/// </summary>
+		internal static int FlushCount { get; private set; } = 0;
+
+		/// <summary>
+		/// Incremented at the end of every frame, invalidating any transient Mesh data
 		/// </summary>
-		public static bool OriginBottomLeft => Renderer == Renderers.OpenGL;
+		internal static int Frame { get; private set; } = 0;
 
 		/// <summary>
 		/// Sets up Graphics properties
@@ -38,6 +98,7 @@ namespace Foster.Framework
 		{
 			Renderer = Platform.FosterGetRenderer();
 			MaxTextureSize = Platform.FosterGetMaxTextureSize();
+			Platform.FosterSetUploadBudget(uploadBudget);
 		}
 
 		/// <summary>
@@ -51,9 +112,9 @@ namespace Foster.Framework
 		/// <summary>
 		/// Clears the Back Buffer
 		/// </summary>
-		public static unsafe void Clear(Color color, float depth, int stencil, ClearMask mask)
+		public static void Clear(Color color, float depth, int stencil, ClearMask mask)
 		{
-			Platform.FosterClearCommand clear = new()
+			Queue(new Platform.FosterClearCommand()
 			{
 				target = IntPtr.Zero,
 				clip = new(0, 0, Width, Height),
@@ -61,10 +122,29 @@ namespace Foster.Framework
 				depth = depth,
 				stencil = stencil,
 				mask = mask
-			};
-			Platform.FosterClear(&clear);
+			});
+		}
+
+		/// <summary>
+		/// Discards the contents of the given Back Buffer buffers, which are no longer needed.
+		/// See <see cref="Target.Discard"/>.
+		/// </summary>
+		public static void Discard(ClearMask mask)
+		{
+			Queue(new Platform.FosterClearCommand()
+			{
+				target = IntPtr.Zero,
+				clip = new(0, 0, Width, Height),
+				mask = ClearMask.None,
+				discard = mask
+			});
 		}
 
+		/// <summary>
+		/// Queues a Draw Command to be rendered.
+		/// The Material's current Uniform values are captured immediately,
+		/// while the actual draw is performed on the next <see cref="Flush"/>.
+		/// </summary>
 		public static unsafe void Submit(in DrawCommand command)
 		{
 			IntPtr shader = IntPtr.Zero;
@@ -89,13 +169,26 @@ namespace Foster.Framework
 				hasScissor = command.Scissor.HasValue ? 1 : 0,
 				indexStart = command.MeshIndexStart,
 				indexCount = command.MeshIndexCount,
-				instanceCount = 0,
+				baseVertex = command.BaseVertex,
+				instanceCount = command.InstanceCount,
+				instanceStart = command.InstanceStart,
 				compare = command.DepthCompare,
 				depthMask = command.DepthMask ? 1 : 0,
 				cull = command.CullMode,
 				blend = command.BlendMode,
+				pipeline = Pipelines.Get(command.DepthCompare, command.DepthMask, command.CullMode, command.BlendMode),
 			};
 
+			if (command.Mesh is Mesh mesh && mesh.IsTransient)
+			{
+				if (mesh.IsTransientExpired)
+					throw new Exception("Mesh Transient data has expired");
+
+				fc.transient = 1;
+				fc.transientVertexOffset = mesh.transientVertexOffset;
+				fc.transientIndexOffset = mesh.transientIndexOffset;
+			}
+
 			if (command.Viewport.HasValue)
 			{
 				fc.viewport = new(
@@ -116,11 +209,243 @@ namespace Foster.Framework
 				);
 			}
 
-			// apply material values before drawing
-			command.Material?.Apply();
+			// copy the ranges, as the array may change before we flush
+			if (command.Ranges != null && command.Ranges.Length > 0)
+			{
+				fc.ranges = AllocateCommandMemory(sizeof(DrawRange) * command.Ranges.Length);
+				fc.rangeCount = command.Ranges.Length;
+				command.Ranges.AsSpan().CopyTo(new Span<DrawRange>((void*)fc.ranges, command.Ranges.Length));
+			}
+
+			// capture material values, as the Material may change before we flush
+			command.Material?.CopyUniforms(ref fc);
+
+			if (SortDraws)
+			{
+				var texture = fc.uniformTextures != IntPtr.Zero ? *(nint*)fc.uniformTextures : IntPtr.Zero;
+				fc.sortKey = GetSortKey(command, shader, texture);
+				fc.sortBarrier = command.SortBarrier ? 1 : 0;
+			}
+
+			Queue(fc);
+		}
+
+		/// <summary>
+		/// Sends all queued Clear and Draw Commands to the Platform in a single call.
+		/// This is done automatically at the end of the frame, and before any
+		/// resource data the queued commands may depend on is modified.
+		/// </summary>
+		public static unsafe void Flush()
+		{
+			// resources may be about to change, so copied uniforms can't be reused
+			FlushCount++;
+
+			if (commandCount <= 0)
+				return;
+
+			fixed (Platform.FosterCommand* ptr = commands)
+			{
+				if (SortDraws)
+					Platform.FosterSubmitSortedCommands(ptr, commandCount);
+				else
+					Platform.FosterSubmitCommands(ptr, commandCount);
+			}
+
+			commandCount = 0;
+			commandMemoryBlock = 0;
+			commandMemoryOffset = 0;
+		}
 
-			// perform draw
-			Platform.FosterDraw(&fc);
+		/// <summary>
+		/// Flushes the queued commands only if one of them draws the Mesh, as its data is about to change.
+		/// Otherwise they keep waiting, so batching and sorting aren't cut short.
+		/// </summary>
+		internal static void FlushIfQueued(Mesh mesh)
+		{
+			for (int i = 0; i < commandCount; i++)
+			{
+				if (commands[i].type == Platform.FosterCommandType.Draw && commands[i].draw.mesh == mesh.resource)
+				{
+					Flush();
+					return;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Flushes any remaining commands and ends the frame
+		/// </summary>
+		internal static void EndFrame()
+		{
+			Flush();
+			Uploads.SubmitQueued();
+			Platform.FosterGetFrameStats(out var stats);
+			Stats = stats;
+			Platform.FosterEndFrame();
+			Frame++;
+		}
+
+		/// <summary>
+		/// Packs a draw's sort key, from the highest bits down:
+		/// layer (8), blended (1), then for opaque draws shader (16), texture (16)
+		/// and depth front to back (23), or for blended draws depth back to front (23).
+		/// </summary>
+		private static ulong GetSortKey(in DrawCommand command, nint shader, nint texture)
+		{
+			// positive floats sort the same as their bits, so the top 23 bits will do
+			static ulong Depth(float depth)
+				=> (ulong)(BitConverter.SingleToUInt32Bits(Math.Max(depth, 0)) >> 8) & 0x7FFFFF;
+
+			// only needs to group equal handles together, so collisions are harmless
+			static ulong Hash(nint handle)
+				=> ((ulong)handle * 0x9E3779B97F4A7C15UL) >> 48;
+
+			var blend = command.BlendMode;
+			var blended =
+				blend.ColorOperation != BlendOp.Add || blend.ColorSource != BlendFactor.One || blend.ColorDestination != BlendFactor.Zero ||
+				blend.AlphaOperation != BlendOp.Add || blend.AlphaSource != BlendFactor.One || blend.AlphaDestination != BlendFactor.Zero;
+
+			ulong key = (ulong)Math.Clamp(command.Layer, 0, 255) << 56;
+			if (blended)
+				key |= (1UL << 55) | ((0x7FFFFF - Depth(command.SortDepth)) << 32);
+			else
+				key |= (Hash(shader) << 39) | (Hash(texture) << 23) | Depth(command.SortDepth);
+			return key;
+		}
+
+		/// <summary>
+		/// Allocates unmanaged memory that stays valid until the next Flush
+		/// </summary>
+		internal static unsafe nint AllocateCommandMemory(int size)
+		{
+			// keep allocations aligned
+			size = (size + 15) & ~15;
+
+			while (commandMemoryBlock < commandMemory.Count)
+			{
+				var block = commandMemory[commandMemoryBlock];
+				if (commandMemoryOffset + size <= block.Size)
+				{
+					var ptr = block.Ptr + commandMemoryOffset;
+					commandMemoryOffset += size;
+					return ptr;
+				}
+
+				commandMemoryBlock++;
+				commandMemoryOffset = 0;
+			}
+
+			var blockSize = Math.Max(CommandMemoryBlockSize, size);
+			commandMemory.Add((new nint(NativeMemory.Alloc((nuint)blockSize)), blockSize));
+			commandMemoryOffset = size;
+			return commandMemory[commandMemoryBlock].Ptr;
+		}
+
+		private static void Queue(in Platform.FosterDrawCommand draw)
+		{
+			ref var it = ref Append();
+			it.type = Platform.FosterCommandType.Draw;
+			it.draw = draw;
+		}
+
+		internal static void Queue(in Platform.FosterClearCommand clear)
+		{
+			ref var it = ref Append();
+			it.type = Platform.FosterCommandType.Clear;
+			it.clear = clear;
+		}
+
+		private static ref Platform.FosterCommand Append()
+		{
+			if (commandCount >= commands.Length)
+				Array.Resize(ref commands, commands.Length * 2);
+			return ref commands[commandCount++];
+		}
+
+		internal static class Uploads
+		{
+			private readonly record struct Queued(Texture Texture, RectInt Rect, byte[] Data);
+			private static readonly Queue<Queued> queued = new();
+			private static int queuedSize = 0;
+
+			/// <summary>
+			/// Bytes of uploads queued from other threads
+			/// </summary>
+			public static int QueuedSize => queuedSize;
+
+			/// <summary>
+			/// Copies Texture data queued from another thread, to be uploaded on the main thread
+			/// </summary>
+			public static void Queue(Texture texture, in RectInt rect, ReadOnlySpan<byte> data, int stride)
+			{
+				var rowSize = rect.Width * texture.Format.Size();
+				var copy = new byte[rowSize * rect.Height];
+				for (int y = 0; y < rect.Height; y++)
+					data.Slice(y * stride, rowSize).CopyTo(copy.AsSpan(y * rowSize));
+
+				lock (queued)
+				{
+					queued.Enqueue(new(texture, rect, copy));
+					queuedSize += copy.Length;
+				}
+			}
+
+			/// <summary>
+			/// Starts all uploads queued from other threads.
+			/// This should only be run from the Main thread.
+			/// </summary>
+			public static void SubmitQueued()
+			{
+				Debug.Assert(Thread.CurrentThread.ManagedThreadId == App.MainThreadID);
+
+				lock (queued)
+				{
+					while (queued.Count > 0)
+					{
+						var it = queued.Dequeue();
+						queuedSize -= it.Data.Length;
+						if (!it.Texture.IsDisposed)
+							it.Texture.SetDataAsync<byte>(it.Rect, it.Data);
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Native Pipelines for each combination of render state that has been drawn with.
+		/// There are usually only a handful, so they're kept until the Application shuts down.
+		/// </summary>
+		internal static class Pipelines
+		{
+			private readonly record struct Key(DepthCompare Compare, bool DepthMask, CullMode Cull, BlendMode Blend);
+			private static readonly Dictionary<Key, nint> pipelines = new();
+
+			public static nint Get(DepthCompare compare, bool depthMask, CullMode cull, BlendMode blend)
+			{
+				var key = new Key(compare, depthMask, cull, blend);
+				if (!pipelines.TryGetValue(key, out var pipeline))
+				{
+					pipeline = Platform.FosterPipelineCreate(new Platform.FosterPipelineDesc()
+					{
+						compare = compare,
+						depthMask = depthMask ? 1 : 0,
+						cull = cull,
+						blend = blend,
+					});
+					pipelines.Add(key, pipeline);
+				}
+				return pipeline;
+			}
+
+			/// <summary>
+			/// Destroys every Pipeline. Any queued commands must have been flushed.
+			/// </summary>
+			public static void DestroyAll()
+			{
+				foreach (var pipeline in pipelines.Values)
+					Platform.FosterPipelineDestroy(pipeline);
+				pipelines.Clear();
+			}
 		}
 
 		internal static class Resources
@@ -213,6 +538,9 @@ namespace Foster.Framework
 			{
 				Allocated? alloc = null;
 
+				// queued commands may still reference this resource
+				Flush();
+
 				// remove from the allocated list
 				lock (allocated)
 				{
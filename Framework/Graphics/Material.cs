@@ -23,6 +23,15 @@ public class Material
 	private float[] floatBuffer = Array.Empty<float>();
 	private readonly List<Uniform> uniforms = new();
 
+	// Uniform values copied into command memory are reused by later
+	// draws until the values change or the commands are flushed
+	private int version = 0;
+	private int copiedVersion = -1;
+	private int copiedFlush = -1;
+	private nint copiedValues;
+	private nint copiedSamplers;
+	private nint copiedTextures;
+
 	/// <summary>
 	/// The current Shader the Material is using.
 	/// If null, the Material will not have any Uniforms.
@@ -49,6 +58,7 @@ public class Material
 		Array.Fill(samplerBuffer, new());
 		Array.Fill(textureBuffer, null);
 		Array.Fill(floatBuffer, 0.0f);
+		version++;
 	}
 
 	/// <summary>
@@ -60,6 +70,7 @@ public class Material
 		samplerBuffer.AsSpan().CopyTo(material.samplerBuffer);
 		textureBuffer.AsSpan().CopyTo(material.textureBuffer);
 		floatBuffer.AsSpan().CopyTo(material.floatBuffer);
+		material.version++;
 	}
 
 	/// <summary>
@@ -112,6 +123,7 @@ public class Material
 					floatLength += it.BufferLength;
 					break;
 				case UniformType.Texture2D:
+				case UniformType.Texture2DArray:
 					it = new(u.Name, u.Index, textureLength, u.ArrayElements, u.Type, u.ArrayElements);
 					textureLength += it.BufferLength;
 					break;
@@ -211,19 +223,30 @@ public class Material
 			throw new Exception($"Uniform '{uniform}' is not a Float value type");
 
 		var subspan = values[0..Math.Min(values.Length, it.BufferLength)];
-		subspan.CopyTo(floatBuffer.AsSpan()[it.BufferStart..]);
+		var dest = floatBuffer.AsSpan(it.BufferStart, subspan.Length);
+		if (!subspan.SequenceEqual(dest))
+		{
+			subspan.CopyTo(dest);
+			version++;
+		}
 	}
 
 	public unsafe void Set(string uniform, Texture? texture, int index = 0)
 	{
 		var it = Get(uniform);
 
-		if (it.Type != UniformType.Texture2D)
+		if (it.Type != UniformType.Texture2D && it.Type != UniformType.Texture2DArray)
 			throw new Exception($"Uniform '{uniform}' is not a Texture2D value type");
 		if (index >= it.BufferLength)
 			throw new Exception($"Uniform '{uniform}' with index {index} is out of bounds");
+		if (texture != null && texture.IsArray != (it.Type == UniformType.Texture2DArray))
+			throw new Exception($"Uniform '{uniform}' is a {it.Type}, which doesn't match the Texture");
 
-		textureBuffer[it.BufferStart + index] = texture;
+		if (textureBuffer[it.BufferStart + index] != texture)
+		{
+			textureBuffer[it.BufferStart + index] = texture;
+			version++;
+		}
 	}
 
 	public unsafe void Set(string uniform, TextureSampler sampler, int index = 0)
@@ -235,24 +258,50 @@ public class Material
 		if (index >= it.BufferLength)
 			throw new Exception($"Uniform '{uniform}' with index {index} is out of bounds");
 
-		samplerBuffer[it.BufferStart + index] = sampler;
+		if (samplerBuffer[it.BufferStart + index] != sampler)
+		{
+			samplerBuffer[it.BufferStart + index] = sampler;
+			version++;
+		}
 	}
 
 	/// <summary>
-	/// Uploads the Uniform Values in this Material to the Shader
+	/// Copies the Uniform Values in this Material into memory owned by the
+	/// queued Draw Command, which applies them to the Shader when it is submitted
 	/// </summary>
-	internal unsafe void Apply()
+	internal unsafe void CopyUniforms(ref Platform.FosterDrawCommand command)
 	{
 		if (Shader == null || Shader.IsDisposed)
 			return;
 
-		var id = Shader.resource;
+		// nothing has changed since the last copy, so it can be shared,
+		// which also lets the Platform skip applying it again
+		if (copiedVersion == version && copiedFlush == Graphics.FlushCount)
+		{
+			command.uniformValues = copiedValues;
+			command.uniformSamplers = copiedSamplers;
+			command.uniformTextures = copiedTextures;
+			return;
+		}
 
-		fixed (float* floatPtr = floatBuffer)
-		fixed (TextureSampler* samplerPtr = samplerBuffer)
+		if (floatBuffer.Length > 0)
 		{
+			command.uniformValues = Graphics.AllocateCommandMemory(sizeof(float) * floatBuffer.Length);
+			floatBuffer.AsSpan().CopyTo(new Span<float>((void*)command.uniformValues, floatBuffer.Length));
+		}
+
+		if (samplerBuffer.Length > 0)
+		{
+			command.uniformSamplers = Graphics.AllocateCommandMemory(sizeof(TextureSampler) * samplerBuffer.Length);
+			samplerBuffer.AsSpan().CopyTo(new Span<TextureSampler>((void*)command.uniformSamplers, samplerBuffer.Length));
+		}
+
+		if (textureBuffer.Length > 0)
+		{
+			command.uniformTextures = Graphics.AllocateCommandMemory(sizeof(IntPtr) * textureBuffer.Length);
+
 			// copy texture values to int pointers buffer
-			var texturePtr = stackalloc IntPtr[textureBuffer.Length];
+			var texturePtr = (IntPtr*)command.uniformTextures;
 			for (int i = 0; i < textureBuffer.Length; i ++)
 			{
 				if (textureBuffer[i] is Texture texture && !texture.IsDisposed)
@@ -260,25 +309,13 @@ public class Material
 				else
 					texturePtr[i] = IntPtr.Zero;
 			}
-
-			// apply each uniform value
-			for (var i = 0; i < uniforms.Count; i++)
-			{
-				var uniform = uniforms[i];
-				if (IsFloat(uniform.Type))
-				{
-					Platform.FosterShaderSetUniform(id, uniform.Index, floatPtr + uniform.BufferStart);
-				}
-				else if (uniform.Type == UniformType.Sampler2D)
-				{
-					Platform.FosterShaderSetSampler(id, uniform.Index, samplerPtr + uniform.BufferStart);
-				}
-				else if (uniform.Type == UniformType.Texture2D)
-				{
-					Platform.FosterShaderSetTexture(id, uniform.Index, texturePtr + uniform.BufferStart);
-				}
-			}
 		}
+
+		copiedVersion = version;
+		copiedFlush = Graphics.FlushCount;
+		copiedValues = command.uniformValues;
+		copiedSamplers = command.uniformSamplers;
+		copiedTextures = command.uniformTextures;
 	}
 
 	/// <summary>
@@ -310,6 +347,7 @@ public class Material
 		UniformType.Mat4x4 => true,
 		UniformType.Texture2D => false,
 		UniformType.Sampler2D => false,
+		UniformType.Texture2DArray => false,
 		_ => false
 	};
 }
@@ -39,15 +39,45 @@ public class Mesh : IResource
 	/// </summary>
 	public VertexFormat? VertexFormat { get; private set; }
 
+	/// <summary>
+	/// Number of Instances in the Mesh
+	/// </summary>
+	public int InstanceCount { get; private set; } = 0;
+
+	/// <summary>
+	/// Current Instance Format
+	/// </summary>
+	public VertexFormat? InstanceFormat { get; private set; }
+
+	/// <summary>
+	/// How often the Mesh's data is expected to change
+	/// </summary>
+	public MeshUsage Usage { get; }
+
+	/// <summary>
+	/// If the Mesh is currently drawing from data set with <see cref="SetTransient"/>
+	/// </summary>
+	public bool IsTransient => transientFrame >= 0;
+
+	/// <summary>
+	/// If the Mesh's transient data was set in a previous frame and can no longer be drawn
+	/// </summary>
+	public bool IsTransientExpired => transientFrame >= 0 && transientFrame != Graphics.Frame;
+
 	internal IntPtr resource;
 	internal bool disposed = false;
+	internal int transientFrame = -1;
+	internal int transientVertexOffset;
+	internal int transientIndexOffset;
 
 	/// <summary>
 	/// Creates a new Mesh for rendering
 	/// </summary>
-	public Mesh()
+	/// <param name="usage">How often the Mesh's data is expected to change</param>
+	public Mesh(MeshUsage usage = MeshUsage.Dynamic)
 	{
-		resource = Platform.FosterMeshCreate();
+		Usage = usage;
+		resource = Platform.FosterMeshCreate(usage);
 		if (resource == IntPtr.Zero)
 			throw new Exception("Failed to create Mesh");
 		Graphics.Resources.RegisterAllocated(this, resource, Platform.FosterMeshDestroy);
@@ -106,7 +136,11 @@ public class Mesh : IResource
 		if (IsDisposed)
 			throw new Exception("Resource is Disposed");
 
+		// queued commands may still be using the current data
+		Graphics.FlushIfQueued(this);
+
 		IndexCount = count;
+		transientFrame = -1;
 
 		if (!IndexFormat.HasValue || IndexFormat.Value != format)
 		{
@@ -148,6 +182,9 @@ public class Mesh : IResource
 		if (IsDisposed)
 			throw new Exception("Resource is Disposed");
 
+		// queued commands may still be using the current data
+		Graphics.FlushIfQueued(this);
+
 		if (!IndexFormat.HasValue)
 			throw new Exception("Must call SetIndices before SetSubIndices");
 
@@ -199,29 +236,17 @@ public class Mesh : IResource
 		if (IsDisposed)
 			throw new Exception("Resource is Disposed");
 
+		// queued commands may still be using the current data
+		Graphics.FlushIfQueued(this);
+
 		VertexCount = count;
+		transientFrame = -1;
 
 		// update vertex format
 		if (!VertexFormat.HasValue || VertexFormat.Value != format)
 		{
 			VertexFormat = format;
-
-			var elements = stackalloc Platform.FosterVertexElement[format.Elements.Length];
-			for (int i = 0; i < format.Elements.Length; i++)
-			{
-				elements[i].index = format.Elements[i].Index;
-				elements[i].type = format.Elements[i].Type;
-				elements[i].normalized = format.Elements[i].Normalized ? 1 : 0;
-			}
-
-			Platform.FosterVertexFormat f = new()
-			{
-				elements = new IntPtr(elements),
-				elementCount = format.Elements.Length,
-				stride = format.Stride
-			};
-
-			Platform.FosterMeshSetVertexFormat(resource, ref f);
+			ApplyFormat(format, false);
 		}
 
 		Platform.FosterMeshSetVertexData(
@@ -255,6 +280,9 @@ public class Mesh : IResource
 		if (IsDisposed)
 			throw new Exception("Resource is Disposed");
 
+		// queued commands may still be using the current data
+		Graphics.FlushIfQueued(this);
+
 		if (!VertexFormat.HasValue)
 			throw new Exception("Must call SetVertices before SetSubVertices");
 
@@ -269,6 +297,163 @@ public class Mesh : IResource
 		);
 	}
 
+	/// <summary>
+	/// Copies Vertex and Index data into memory shared by all Meshes that is only valid for the current frame.
+	/// This avoids waiting on the GPU and flushing queued commands, and is intended for geometry that
+	/// is rebuilt every frame. The Mesh can't be drawn once the frame ends, until its data is set again.
+	/// Returns false if there isn't enough transient memory left this frame, in which case
+	/// the data should be uploaded with <see cref="SetVertices(nint, int, Framework.VertexFormat)"/> and <see cref="SetIndices(nint, int, Framework.IndexFormat)"/> instead.
+	/// </summary>
+	public unsafe bool SetTransient(nint vertices, int vertexCount, VertexFormat vertexFormat, nint indices, int indexCount, IndexFormat indexFormat)
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		var vertexSize = vertexFormat.Stride * vertexCount;
+		var indexSize = GetIndexFormatSize(indexFormat) * indexCount;
+
+		// both ranges are allocated together, so a failure never leaves one unused
+		if (Platform.FosterTransientAllocGeometry(vertexSize, indexSize, out var vertexDest, out var indexDest, out var vertexOffset, out var indexOffset) == 0)
+			return false;
+
+		Buffer.MemoryCopy((void*)vertices, (void*)vertexDest, vertexSize, vertexSize);
+		Buffer.MemoryCopy((void*)indices, (void*)indexDest, indexSize, indexSize);
+
+		// queued commands only need to be flushed if they depend on the formats
+		if (!VertexFormat.HasValue || VertexFormat.Value != vertexFormat)
+		{
+			Graphics.FlushIfQueued(this);
+			VertexFormat = vertexFormat;
+			ApplyFormat(vertexFormat, false);
+		}
+
+		if (!IndexFormat.HasValue || IndexFormat.Value != indexFormat)
+		{
+			Graphics.FlushIfQueued(this);
+			IndexFormat = indexFormat;
+			Platform.FosterMeshSetIndexFormat(resource, indexFormat);
+		}
+
+		VertexCount = vertexCount;
+		IndexCount = indexCount;
+		transientFrame = Graphics.Frame;
+		transientVertexOffset = vertexOffset;
+		transientIndexOffset = indexOffset;
+		return true;
+	}
+
+	/// <summary>
+	/// Uploads the per-Instance data to the Mesh.
+	/// Each Instance advances the attributes in the Instance Format once,
+	/// which are drawn by setting <see cref="DrawCommand.InstanceCount"/>.
+	/// </summary>
+	public unsafe void SetInstances<T>(ReadOnlySpan<T> instances) where T : struct, IVertex
+	{
+		SetInstances(instances, default(T).Format);
+	}
+
+	/// <summary>
+	/// Uploads the per-Instance data to the Mesh.
+	/// </summary>
+	public unsafe void SetInstances<T>(ReadOnlySpan<T> instances, VertexFormat format) where T : struct
+	{
+		fixed (byte* ptr = MemoryMarshal.AsBytes(instances))
+		{
+			SetInstances(new IntPtr(ptr), instances.Length, format);
+		}
+	}
+
+	/// <summary>
+	/// Uploads the per-Instance data to the Mesh.
+	/// </summary>
+	public void SetInstances(IntPtr data, int count, VertexFormat format)
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		// queued commands may still be using the current data
+		Graphics.FlushIfQueued(this);
+
+		InstanceCount = count;
+
+		// update instance format
+		if (!InstanceFormat.HasValue || InstanceFormat.Value != format)
+		{
+			InstanceFormat = format;
+			ApplyFormat(format, true);
+		}
+
+		Platform.FosterMeshSetInstanceData(
+			resource,
+			data,
+			format.Stride * count,
+			0
+		);
+	}
+
+	/// <summary>
+	/// Uploads a sub area of per-Instance data to the Mesh.
+	/// The Mesh must already be able to fit this with a previous call to SetInstances.
+	/// This also cannot modify the existing Instance Format.
+	/// </summary>
+	public unsafe void SetSubInstances<T>(int offset, ReadOnlySpan<T> instances) where T : struct
+	{
+		fixed (byte* ptr = MemoryMarshal.AsBytes(instances))
+		{
+			SetSubInstances(offset, new IntPtr(ptr), instances.Length);
+		}
+	}
+
+	/// <summary>
+	/// Uploads a sub area of per-Instance data to the Mesh.
+	/// The Mesh must already be able to fit this with a previous call to SetInstances.
+	/// This also cannot modify the existing Instance Format.
+	/// </summary>
+	public void SetSubInstances(int offset, IntPtr data, int count)
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		// queued commands may still be using the current data
+		Graphics.FlushIfQueued(this);
+
+		if (!InstanceFormat.HasValue)
+			throw new Exception("Must call SetInstances before SetSubInstances");
+
+		if (offset + count > InstanceCount)
+			throw new Exception("SetSubInstances is out of range of the existing Instance Buffer");
+
+		Platform.FosterMeshSetInstanceData(
+			resource,
+			data,
+			InstanceFormat.Value.Stride * count,
+			InstanceFormat.Value.Stride * offset
+		);
+	}
+
+	private unsafe void ApplyFormat(VertexFormat format, bool instanced)
+	{
+		var elements = stackalloc Platform.FosterVertexElement[format.Elements.Length];
+		for (int i = 0; i < format.Elements.Length; i++)
+		{
+			elements[i].index = format.Elements[i].Index;
+			elements[i].type = format.Elements[i].Type;
+			elements[i].normalized = format.Elements[i].Normalized ? 1 : 0;
+		}
+
+		Platform.FosterVertexFormat f = new()
+		{
+			elements = new IntPtr(elements),
+			elementCount = format.Elements.Length,
+			stride = format.Stride
+		};
+
+		if (instanced)
+			Platform.FosterMeshSetInstanceFormat(resource, ref f);
+		else
+			Platform.FosterMeshSetVertexFormat(resource, ref f);
+	}
+
 	/// <summary>
 	/// Disposes the graphical resources of the Mesh. Once Disposed, the Mesh
 	/// is no longer usable.
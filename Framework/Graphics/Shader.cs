@@ -5,7 +5,8 @@ namespace Foster.Framework;
 public struct ShaderCreateInfo(
 	string vertexShader,
 	string fragmentShader,
-	ShaderCreateInfo.Attribute[]? attributes = null)
+	ShaderCreateInfo.Attribute[]? attributes = null,
+	string[]? defines = null)
 {
 	public readonly record struct Attribute(string SemanticName, int SemanticIndex);
 
@@ -23,18 +24,27 @@ public struct ShaderCreateInfo(
 	/// Attributes, required if using HLSL / D3D11
 	/// </summary>
 	public Attribute[]? Attributes = attributes;
+
+	/// <summary>
+	/// Macros defined at the top of both stages, ie "FOG" or "LIGHTS 4".
+	/// Shaders with the same source and defines share one compiled program,
+	/// which isn't compiled until the Shader is first used.
+	/// </summary>
+	public string[]? Defines = defines;
 }
 
 public class Shader : IResource
 {
 	/// <summary>
-	/// Shader Uniform Entry
+	/// Shader Uniform Entry.
+	/// BufferIndex is the Uniform Block the Uniform belongs to, or -1 if it isn't in one.
 	/// </summary>
 	public readonly record struct Uniform(
 		int Index,
 		string Name,
 		UniformType Type, 
-		int ArrayElements
+		int ArrayElements,
+		int BufferIndex = -1
 	);
 
 	/// <summary>
@@ -48,25 +58,58 @@ public class Shader : IResource
 	public bool IsDisposed => disposed;
 
 	/// <summary>
-	/// Dictionary of Uniforms in the Shader
+	/// If the Shader has finished compiling.
+	/// This is always true unless it was created with compileAsync or Defines.
 	/// </summary>
-	public readonly ReadOnlyDictionary<string, Uniform> Uniforms;
+	public bool IsReady => disposed || Platform.FosterShaderIsReady(resource) != 0;
+
+	/// <summary>
+	/// Dictionary of Uniforms in the Shader.
+	/// If the Shader is still compiling, this waits for it to finish.
+	/// </summary>
+	public ReadOnlyDictionary<string, Uniform> Uniforms => uniforms ??= GetUniforms();
 
 	internal readonly IntPtr resource;
 	internal bool disposed = false;
+	private ReadOnlyDictionary<string, Uniform>? uniforms;
 
-	public Shader(in ShaderCreateInfo createInfo)
+	/// <summary>
+	/// Creates a Shader. With compileAsync the driver compiles it in the background,
+	/// and <see cref="IsReady"/> can be polled to find out when it's done. Compile
+	/// errors are then only logged, and the Shader draws nothing.
+	/// </summary>
+	public Shader(in ShaderCreateInfo createInfo, bool compileAsync = false)
 	{
 		Platform.FosterShaderData data = new()
 		{
 			fragment = createInfo.FragmentShader,
-			vertex = createInfo.VertexShader
+			vertex = createInfo.VertexShader,
+			defines = createInfo.Defines is { Length: > 0 } ? string.Join('\n', createInfo.Defines) : null
 		};
 
-		resource = Platform.FosterShaderCreate(ref data);
+		resource = compileAsync
+			? Platform.FosterShaderCreateAsync(ref data)
+			: Platform.FosterShaderCreate(ref data);
 		if (resource == IntPtr.Zero)
 			throw new Exception("Failed to create Shader");
 
+		// variants are compiled on first use, so their uniforms are too
+		if (!compileAsync && data.defines == null)
+			uniforms = GetUniforms();
+
+		Graphics.Resources.RegisterAllocated(this, resource, Platform.FosterShaderDestroy);
+	}
+
+	~Shader()
+	{
+		Dispose(false);
+	}
+
+	private ReadOnlyDictionary<string, Uniform> GetUniforms()
+	{
+		if (disposed)
+			return new Dictionary<string, Uniform>().AsReadOnly();
+
 		var infos = new Platform.FosterUniformInfo[64];
 		var count = 0;
 
@@ -86,21 +129,15 @@ public class Shader : IResource
 		}
 
 		// add each uniform
-		var uniforms = new Dictionary<string, Uniform>();
+		var result = new Dictionary<string, Uniform>();
 		for (int i = 0; i < count; i ++)
 		{
 			var info = infos[i];
 			var name = Platform.ParseUTF8(info.name);
-			uniforms.Add(name, new (info.index, name, info.type, info.arrayElements));
+			result.Add(name, new (info.index, name, info.type, info.arrayElements, info.bufferIndex));
 		}
 
-		Uniforms = uniforms.AsReadOnly();
-		Graphics.Resources.RegisterAllocated(this, resource, Platform.FosterShaderDestroy);
-	}
-
-	~Shader()
-	{
-		Dispose(false);
+		return result.AsReadOnly();
 	}
 
 	/// <summary>
@@ -2,42 +2,145 @@ namespace Foster.Framework;
 
 internal static class ShaderDefaults
 {
-	public static Dictionary<Renderers, ShaderCreateInfo> Batcher = new()
-	{
-		[Renderers.OpenGL] = new()
+	private const string BatcherFragmentGLSL =
+		@"#version 330
+		uniform sampler2D u_texture;
+		in vec2 v_tex;
+		in vec4 v_col;
+		in vec4 v_type;
+		out vec4 o_color;
+		void main(void)
 		{
-			VertexShader =
-				@"#version 330
-				uniform mat4 u_matrix;
-				layout(location=0) in vec2 a_position;
-				layout(location=1) in vec2 a_tex;
-				layout(location=2) in vec4 a_color;
-				layout(location=3) in vec4 a_type;
-				out vec2 v_tex;
-				out vec4 v_col;
-				out vec4 v_type;
-				void main(void)
-				{
-					gl_Position = u_matrix * vec4(a_position.xy, 0, 1);
-					v_tex = a_tex;
-					v_col = a_color;
-					v_type = a_type;
-				}",
-			FragmentShader =
-				@"#version 330
-				uniform sampler2D u_texture;
-				in vec2 v_tex;
-				in vec4 v_col;
-				in vec4 v_type;
-				out vec4 o_color;
-				void main(void)
+			vec4 color = texture(u_texture, v_tex);
+			o_color = 
+				v_type.x * color * v_col + 
+				v_type.y * color.a * v_col + 
+				v_type.z * v_col;
+		}";
+
+	private const string BatcherVertexGLSL =
+		@"#version 330
+		uniform mat4 u_matrix;
+		layout(location=0) in vec2 a_position;
+		layout(location=1) in vec2 a_tex;
+		layout(location=2) in vec4 a_color;
+		layout(location=3) in vec4 a_type;
+		out vec2 v_tex;
+		out vec4 v_col;
+		out vec4 v_type;
+		void main(void)
+		{
+			gl_Position = u_matrix * vec4(a_position.xy, 0, 1);
+			v_tex = a_tex;
+			v_col = a_color;
+			v_type = a_type;
+		}";
+
+	/// <summary>
+	/// Binds up to 8 Textures, using the Vertex Mode's alpha as the Texture Slot.
+	/// GLSL 330 can only index sampler arrays with constants, hence the switch.
+	/// </summary>
+	private static readonly ShaderCreateInfo BatcherGLSL = new()
+	{
+		VertexShader = BatcherVertexGLSL,
+		FragmentShader =
+			@"#version 330
+			uniform sampler2D u_texture[8];
+			in vec2 v_tex;
+			in vec4 v_col;
+			in vec4 v_type;
+			out vec4 o_color;
+			vec4 sample_texture(int slot, vec2 uv)
+			{
+				switch (slot)
 				{
-					vec4 color = texture(u_texture, v_tex);
-					o_color = 
-						v_type.x * color * v_col + 
-						v_type.y * color.a * v_col + 
-						v_type.z * v_col;
-				}"
-		}
+					case 1: return texture(u_texture[1], uv);
+					case 2: return texture(u_texture[2], uv);
+					case 3: return texture(u_texture[3], uv);
+					case 4: return texture(u_texture[4], uv);
+					case 5: return texture(u_texture[5], uv);
+					case 6: return texture(u_texture[6], uv);
+					case 7: return texture(u_texture[7], uv);
+					default: return texture(u_texture[0], uv);
+				}
+			}
+			void main(void)
+			{
+				vec4 color = sample_texture(int(v_type.w * 255.0 + 0.5), v_tex);
+				o_color = 
+					v_type.x * color * v_col + 
+					v_type.y * color.a * v_col + 
+					v_type.z * v_col;
+			}"
+	};
+
+	/// <summary>
+	/// Samples a Texture Array, using the Vertex Mode's alpha as the Layer
+	/// </summary>
+	private static readonly ShaderCreateInfo BatcherArrayGLSL = new()
+	{
+		VertexShader = BatcherVertexGLSL,
+		FragmentShader =
+			@"#version 330
+			uniform sampler2DArray u_texture;
+			in vec2 v_tex;
+			in vec4 v_col;
+			in vec4 v_type;
+			out vec4 o_color;
+			void main(void)
+			{
+				vec4 color = texture(u_texture, vec3(v_tex, floor(v_type.w * 255.0 + 0.5)));
+				o_color = 
+					v_type.x * color * v_col + 
+					v_type.y * color.a * v_col + 
+					v_type.z * v_col;
+			}"
+	};
+
+	/// <summary>
+	/// Expands each Sprite instance from a unit quad, for Batcher.Instancing
+	/// </summary>
+	private static readonly ShaderCreateInfo BatcherInstancedGLSL = new()
+	{
+		VertexShader =
+			@"#version 330
+			uniform mat4 u_matrix;
+			layout(location=0) in vec2 a_corner;
+			layout(location=1) in vec2 a_position;
+			layout(location=2) in vec2 a_axis_x;
+			layout(location=3) in vec2 a_axis_y;
+			layout(location=4) in vec4 a_tex;
+			layout(location=5) in vec4 a_color;
+			layout(location=6) in vec4 a_type;
+			out vec2 v_tex;
+			out vec4 v_col;
+			out vec4 v_type;
+			void main(void)
+			{
+				vec2 position = a_position + a_axis_x * a_corner.x + a_axis_y * a_corner.y;
+				gl_Position = u_matrix * vec4(position, 0, 1);
+				v_tex = mix(a_tex.xy, a_tex.zw, a_corner);
+				v_col = a_color;
+				v_type = a_type;
+			}",
+		FragmentShader = BatcherFragmentGLSL
+	};
+
+	public static Dictionary<Renderers, ShaderCreateInfo> Batcher = new()
+	{
+		[Renderers.OpenGL] = BatcherGLSL,
+		[Renderers.Null] = BatcherGLSL,
+	};
+
+	public static Dictionary<Renderers, ShaderCreateInfo> BatcherArray = new()
+	{
+		[Renderers.OpenGL] = BatcherArrayGLSL,
+		[Renderers.Null] = BatcherArrayGLSL,
+	};
+
+	public static Dictionary<Renderers, ShaderCreateInfo> BatcherInstanced = new()
+	{
+		[Renderers.OpenGL] = BatcherInstancedGLSL,
+		[Renderers.Null] = BatcherInstancedGLSL,
 	};
 }
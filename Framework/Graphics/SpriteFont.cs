@@ -677,7 +677,7 @@ public class SpriteFont
 		private readonly Image image = new(size, size);
 		private readonly Texture texture = new(size, size, TextureFormat.Color);
 		private readonly List<Node> nodes = [ new() { Bounds = new(0, 0, size, size) } ];
-		private bool textureDirty;
+		private RectInt? textureDirty;
 
 		public bool TryPack(Color[] buffer, int width, int height, bool uploadToTexture, out Subtexture result)
 		{
@@ -690,14 +690,9 @@ public class SpriteFont
 				result = new Subtexture(texture, node.Bounds, new Rect(1, 1, width, height));
 
 				if (uploadToTexture)
-				{
-					// TODO: partial rectangle upload
-					texture.SetData<Color>(image.Data);
-				}
+					Upload(node.Bounds);
 				else
-				{
-					textureDirty = true;
-				}
+					textureDirty = textureDirty?.Conflate(node.Bounds) ?? node.Bounds;
 
 				return true;
 			}
@@ -708,13 +703,22 @@ public class SpriteFont
 
 		public void Upload()
 		{
-			if (textureDirty)
+			if (textureDirty.HasValue)
 			{
-				texture.SetData<Color>(image.Data);
-				textureDirty = false;
+				Upload(textureDirty.Value);
+				textureDirty = null;
 			}
 		}
 
+		/// <summary>
+		/// Uploads only the given rectangle of the page, reading its rows straight out of the Image
+		/// </summary>
+		private void Upload(in RectInt rect)
+		{
+			var data = image.Data[(rect.X + rect.Y * image.Width)..];
+			texture.SetData<Color>(rect, data, image.Width * texture.Format.Size());
+		}
+
 		private int TryPackNode(int node, int width, int height)
 		{
 			var it = nodes[node];
@@ -31,6 +31,11 @@ public struct Subtexture
 	/// </summary>
 	public Texture? Texture;
 
+	/// <summary>
+	/// The Layer of the Texture to sample from, if it's a Texture Array
+	/// </summary>
+	public int TextureLayer;
+
 	/// <summary>
 	/// The source rectangle to sample from the Texture
 	/// </summary>
@@ -69,6 +74,12 @@ public struct Subtexture
 
 	}
 
+	public Subtexture(Texture? texture, int textureLayer, Rect source, Rect frame)
+		: this(texture, source, frame)
+	{
+		TextureLayer = textureLayer;
+	}
+
 	public Subtexture(Texture? texture, Rect source, Rect frame)
 	{
 		Texture = texture;
@@ -127,6 +138,6 @@ public struct Subtexture
 	public readonly Subtexture GetClipSubtexture(in Rect clip)
 	{
 		var (source, frame) = GetClip(clip);
-		return new Subtexture(Texture, source, frame);
+		return new Subtexture(Texture, TextureLayer, source, frame);
 	}
 }
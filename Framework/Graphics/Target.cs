@@ -34,6 +34,12 @@ public class Target : IResource
 	/// </summary>
 	public readonly RectInt Bounds;
 
+	/// <summary>
+	/// The number of multisample antialiasing samples, which is 1 unless the Target is multisampled.
+	/// Multisampled Targets must be <see cref="Resolve"/>d before their Attachments are used.
+	/// </summary>
+	public readonly int Samples = 1;
+
 	/// <summary>
 	/// The Texture attachments in the Target. 
 	/// </summary>
@@ -45,7 +51,7 @@ public class Target : IResource
 	public Target(int width, int height)
 		: this(width, height, defaultFormats) { }
 
-	public Target(int width, int height, TextureFormat[] attachments)
+	public Target(int width, int height, TextureFormat[] attachments, int samples = 1)
 	{
 		if (width <= 0 || height <= 0)
 			throw new ArgumentException("Target width and height must be larger than 0");
@@ -53,12 +59,16 @@ public class Target : IResource
 		if (attachments == null || attachments.Length <= 0)
 			throw new ArgumentException("Target needs at least 1 color attachment");
 
-		resource = Platform.FosterTargetCreate(width, height, attachments, attachments.Length);
+		if (samples <= 0)
+			throw new ArgumentException("Target needs at least 1 sample");
+
+		resource = Platform.FosterTargetCreate(width, height, samples, attachments, attachments.Length);
 		if (resource == IntPtr.Zero)
 			throw new Exception("Failed to create Target");
 
 		Width = width;
 		Height = height;
+		Samples = samples;
 		Bounds = new RectInt(0, 0, Width, Height);
 
 		var textures = new List<Texture>();
@@ -88,12 +98,12 @@ public class Target : IResource
 	/// <summary>
 	/// Clears the Target
 	/// </summary>
-	public unsafe void Clear(Color color, float depth, int stencil, ClearMask mask)
+	public void Clear(Color color, float depth, int stencil, ClearMask mask)
 	{
 		if (IsDisposed)
 			throw new Exception("Resource is Disposed");
 
-		Platform.FosterClearCommand clear = new()
+		Graphics.Queue(new Platform.FosterClearCommand()
 		{
 			target = resource,
 			clip = new(0, 0, Width, Height),
@@ -101,9 +111,45 @@ public class Target : IResource
 			depth = depth,
 			stencil = stencil,
 			mask = mask
-		};
+		});
+	}
+
+	/// <summary>
+	/// Discards the contents of the given buffers, which are no longer needed.
+	/// Before drawing to the Target this skips loading its previous contents, and after
+	/// the last draw it skips storing them, which saves bandwidth on tiled GPUs.
+	/// The contents are undefined until they're drawn to or cleared again.
+	/// </summary>
+	public void Discard(ClearMask mask = ClearMask.All)
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		Graphics.Queue(new Platform.FosterClearCommand()
+		{
+			target = resource,
+			clip = new(0, 0, Width, Height),
+			mask = ClearMask.None,
+			discard = mask
+		});
+	}
+
+	/// <summary>
+	/// Resolves the multisampled contents of the Target into its Attachments.
+	/// This does nothing if the Target isn't multisampled.
+	/// </summary>
+	public void Resolve()
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		if (Samples <= 1)
+			return;
+
+		// make sure any queued rendering has been performed
+		Graphics.Flush();
 
-		Platform.FosterClear(&clear);
+		Platform.FosterTargetResolve(resource);
 	}
 
 	/// <summary>
@@ -4,7 +4,7 @@ using System.Runtime.InteropServices;
 namespace Foster.Framework;
 
 /// <summary>
-/// A 2D Texture used for Rendering
+/// A 2D Texture, or 2D Texture Array, used for Rendering
 /// </summary>
 public class Texture : IResource
 {
@@ -33,6 +33,22 @@ public class Texture : IResource
 	/// </summary>
 	public Point2 Size => new(Width, Height);
 
+	/// <summary>
+	/// Gets the number of Layers in the Texture, which is 1 unless it's a Texture Array
+	/// </summary>
+	public readonly int Layers = 1;
+
+	/// <summary>
+	/// If this Texture is a Texture Array, in which case it must be
+	/// sampled as a sampler2DArray by Shaders
+	/// </summary>
+	public readonly bool IsArray;
+
+	/// <summary>
+	/// Gets the number of mip levels in the Texture, which is 1 unless it was created with more
+	/// </summary>
+	public readonly int MipLevels = 1;
+
 	/// <summary>
 	/// The Texture Data Format
 	/// </summary>
@@ -43,25 +59,60 @@ public class Texture : IResource
 	/// </summary>
 	public readonly bool IsTargetAttachment;
 
+	/// <summary>
+	/// The Memory Size of a single Layer of the Texture, in bytes
+	/// </summary>
+	public int LayerMemorySize => Width * Height * Format.Size();
+
 	/// <summary>
 	/// The Memory Size of the Texture, in bytes
 	/// </summary>
-	public int MemorySize => Width * Height * Format.Size();
+	public int MemorySize => LayerMemorySize * Layers;
 
 	internal readonly IntPtr resource;
 	internal bool disposed = false;
 
-	public Texture(int width, int height, TextureFormat format = TextureFormat.Color)
+	public Texture(int width, int height, TextureFormat format = TextureFormat.Color, int mipLevels = 1)
 	{
 		if (width <= 0 || height <= 0)
 			throw new Exception("Texture must have a size larger than 0");
+		if (mipLevels <= 0 || mipLevels > CalculateMipLevels(width, height))
+			throw new ArgumentOutOfRangeException(nameof(mipLevels), "Mip Levels must be between 1 and the full mip chain");
 
-		resource = Platform.FosterTextureCreate(width, height, format);
+		resource = Platform.FosterTextureCreate(width, height, mipLevels, format);
 		if (resource == IntPtr.Zero)
 			throw new Exception("Failed to create Texture");
 
 		Width = width;
 		Height = height;
+		MipLevels = mipLevels;
+		Format = format;
+		IsTargetAttachment = false;
+
+		Graphics.Resources.RegisterAllocated(this, resource, Platform.FosterTextureDestroy);
+	}
+
+	/// <summary>
+	/// Creates a Texture Array, where every Layer has the same size and format
+	/// </summary>
+	public Texture(int width, int height, int layers, TextureFormat format = TextureFormat.Color, int mipLevels = 1)
+	{
+		if (width <= 0 || height <= 0)
+			throw new Exception("Texture must have a size larger than 0");
+		if (layers <= 0)
+			throw new Exception("Texture Array must have at least 1 Layer");
+		if (mipLevels <= 0 || mipLevels > CalculateMipLevels(width, height))
+			throw new ArgumentOutOfRangeException(nameof(mipLevels), "Mip Levels must be between 1 and the full mip chain");
+
+		resource = Platform.FosterTextureCreateArray(width, height, layers, mipLevels, format);
+		if (resource == IntPtr.Zero)
+			throw new Exception("Failed to create Texture");
+
+		Width = width;
+		Height = height;
+		Layers = layers;
+		MipLevels = mipLevels;
+		IsArray = true;
 		Format = format;
 		IsTargetAttachment = false;
 
@@ -112,6 +163,9 @@ public class Texture : IResource
 		if (Unsafe.SizeOf<T>() * data.Length < MemorySize)
 			throw new Exception("Data Buffer is smaller than the Size of the Texture");
 
+		// queued commands may still be using the current data
+		Graphics.Flush();
+
 		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
 		{
 			int length = Unsafe.SizeOf<T>()  * data.Length;
@@ -119,6 +173,176 @@ public class Texture : IResource
 		}
 	}
 
+	/// <summary>
+	/// Sets a rectangle of the Texture from the given buffer, which holds tightly packed rows
+	/// </summary>
+	public void SetData<T>(in RectInt rect, ReadOnlySpan<T> data) where T : struct
+		=> SetData(rect, data, rect.Width * Format.Size());
+
+	/// <summary>
+	/// Sets a rectangle of the Texture from the given buffer, where each row
+	/// starts <paramref name="stride"/> bytes after the previous one
+	/// </summary>
+	public unsafe void SetData<T>(in RectInt rect, ReadOnlySpan<T> data, int stride) where T : struct
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		if (IsArray)
+			throw new Exception("Texture Arrays must be set a Layer at a time");
+
+		if (rect.X < 0 || rect.Y < 0 || rect.Width <= 0 || rect.Height <= 0 || rect.Right > Width || rect.Bottom > Height)
+			throw new ArgumentOutOfRangeException(nameof(rect), "Rectangle is out of bounds of the Texture");
+
+		if (stride < rect.Width * Format.Size())
+			throw new ArgumentOutOfRangeException(nameof(stride), "Stride is smaller than a row of the Rectangle");
+
+		if (Unsafe.SizeOf<T>() * data.Length < stride * (rect.Height - 1) + rect.Width * Format.Size())
+			throw new Exception("Data Buffer is smaller than the Rectangle");
+
+		// queued commands may still be using the current data
+		Graphics.Flush();
+
+		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
+			Platform.FosterTextureSetDataRect(resource, rect.X, rect.Y, rect.Width, rect.Height, ptr, stride);
+	}
+
+	/// <summary>
+	/// Sets the Texture data from the given buffer without waiting on the GPU.
+	/// See <see cref="SetDataAsync{T}(in RectInt, ReadOnlySpan{T}, int)"/>.
+	/// </summary>
+	public void SetDataAsync<T>(ReadOnlySpan<T> data) where T : struct
+		=> SetDataAsync(new RectInt(0, 0, Width, Height), data, Width * Format.Size());
+
+	/// <summary>
+	/// Sets a rectangle of the Texture from the given buffer, which holds tightly packed rows,
+	/// without waiting on the GPU. See <see cref="SetDataAsync{T}(in RectInt, ReadOnlySpan{T}, int)"/>.
+	/// </summary>
+	public void SetDataAsync<T>(in RectInt rect, ReadOnlySpan<T> data) where T : struct
+		=> SetDataAsync(rect, data, rect.Width * Format.Size());
+
+	/// <summary>
+	/// Sets a rectangle of the Texture through a staging buffer, without waiting on the GPU.
+	/// The data is copied immediately, but the Texture may not be updated until a later frame
+	/// if the staging buffer or <see cref="Graphics.UploadBudget"/> has run out.
+	/// This can be called from any thread, in which case the upload starts at the end of the frame.
+	/// </summary>
+	public unsafe void SetDataAsync<T>(in RectInt rect, ReadOnlySpan<T> data, int stride) where T : struct
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		if (IsArray)
+			throw new Exception("Texture Arrays must be set a Layer at a time");
+
+		if (rect.X < 0 || rect.Y < 0 || rect.Width <= 0 || rect.Height <= 0 || rect.Right > Width || rect.Bottom > Height)
+			throw new ArgumentOutOfRangeException(nameof(rect), "Rectangle is out of bounds of the Texture");
+
+		if (stride < rect.Width * Format.Size())
+			throw new ArgumentOutOfRangeException(nameof(stride), "Stride is smaller than a row of the Rectangle");
+
+		if (Unsafe.SizeOf<T>() * data.Length < stride * (rect.Height - 1) + rect.Width * Format.Size())
+			throw new Exception("Data Buffer is smaller than the Rectangle");
+
+		// off the main thread the data is copied, and the upload started at the end of the frame
+		if (Thread.CurrentThread.ManagedThreadId != App.MainThreadID)
+		{
+			Graphics.Uploads.Queue(this, rect, MemoryMarshal.AsBytes(data), stride);
+			return;
+		}
+
+		// queued commands may still be using the current data
+		Graphics.Flush();
+
+		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
+			Platform.FosterTextureSetDataAsync(resource, rect.X, rect.Y, rect.Width, rect.Height, ptr, stride);
+	}
+
+	/// <summary>
+	/// Sets the data of a single Layer of the Texture from the given buffer
+	/// </summary>
+	public unsafe void SetLayerData<T>(int layer, ReadOnlySpan<T> data) where T : struct
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		if (layer < 0 || layer >= Layers)
+			throw new ArgumentOutOfRangeException(nameof(layer), "Layer is out of range of the Texture");
+
+		if (Unsafe.SizeOf<T>() * data.Length < LayerMemorySize)
+			throw new Exception("Data Buffer is smaller than the Size of the Texture Layer");
+
+		// queued commands may still be using the current data
+		Graphics.Flush();
+
+		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
+		{
+			int length = Unsafe.SizeOf<T>() * data.Length;
+			Platform.FosterTextureSetLayerData(resource, layer, ptr, length);
+		}
+	}
+
+	/// <summary>
+	/// Sets the data of a single mip level of the Texture from the given buffer.
+	/// For Texture Arrays, this includes every Layer of the mip level.
+	/// </summary>
+	public unsafe void SetLevelData<T>(int level, ReadOnlySpan<T> data) where T : struct
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		if (level < 0 || level >= MipLevels)
+			throw new ArgumentOutOfRangeException(nameof(level), "Mip Level is out of range of the Texture");
+
+		var size = GetLevelSize(level);
+		if (Unsafe.SizeOf<T>() * data.Length < size.X * size.Y * Format.Size() * Layers)
+			throw new Exception("Data Buffer is smaller than the Size of the Texture mip level");
+
+		// queued commands may still be using the current data
+		Graphics.Flush();
+
+		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
+		{
+			int length = Unsafe.SizeOf<T>() * data.Length;
+			Platform.FosterTextureSetLevelData(resource, level, ptr, length);
+		}
+	}
+
+	/// <summary>
+	/// Generates every mip level below the first from its current contents
+	/// </summary>
+	public void GenerateMipmaps()
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		// queued commands may still be using the current data
+		Graphics.Flush();
+
+		Platform.FosterTextureGenerateMipmaps(resource);
+	}
+
+	/// <summary>
+	/// Gets the size of the given mip level
+	/// </summary>
+	public Point2 GetLevelSize(int level)
+		=> new(Math.Max(1, Width >> level), Math.Max(1, Height >> level));
+
+	/// <summary>
+	/// Calculates the number of mip levels in a full chain down to 1x1 for the given size
+	/// </summary>
+	public static int CalculateMipLevels(int width, int height)
+	{
+		var size = Math.Max(width, height);
+		var levels = 1;
+		while (size > 1)
+		{
+			size >>= 1;
+			levels++;
+		}
+		return levels;
+	}
+
 	/// <summary>
 	/// Writes the Texture data to the given buffer
 	/// </summary>
@@ -130,6 +354,9 @@ public class Texture : IResource
 		if (Unsafe.SizeOf<T>() * data.Length < MemorySize)
 			throw new Exception("Data Buffer is smaller than the Size of the Texture");
 
+		// make sure any queued rendering has been performed
+		Graphics.Flush();
+
 		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
 		{
 			int length = Unsafe.SizeOf<T>() * data.Length;
@@ -137,6 +364,21 @@ public class Texture : IResource
 		}
 	}
 
+	/// <summary>
+	/// Starts reading the Texture data back without waiting on the GPU.
+	/// Check <see cref="TextureReadback.IsReady"/> on later frames, and then get the data from it.
+	/// </summary>
+	public TextureReadback GetDataAsync()
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		// make sure any queued rendering has been performed
+		Graphics.Flush();
+
+		return new TextureReadback(this);
+	}
+
 	public void Dispose()
 	{
 		if (IsTargetAttachment)
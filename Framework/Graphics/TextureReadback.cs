@@ -0,0 +1,108 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace Foster.Framework;
+
+/// <summary>
+/// Texture data being copied back from the GPU, created by <see cref="Texture.GetDataAsync"/>.
+/// Getting the data before it is ready stalls until the GPU has finished the copy.
+/// </summary>
+public class TextureReadback : IResource
+{
+	/// <summary>
+	/// Optional Readback Name
+	/// </summary>
+	public string Name { get; set; } = string.Empty;
+
+	/// <summary>
+	/// If the Readback has been disposed
+	/// </summary>
+	public bool IsDisposed => disposed;
+
+	/// <summary>
+	/// The Texture being read back
+	/// </summary>
+	public readonly Texture Texture;
+
+	/// <summary>
+	/// Size of the read back data, in bytes
+	/// </summary>
+	public readonly int MemorySize;
+
+	/// <summary>
+	/// If the GPU has finished copying the data, and getting it won't stall
+	/// </summary>
+	public bool IsReady
+	{
+		get
+		{
+			if (IsDisposed)
+				throw new Exception("Resource is Disposed");
+			return Platform.FosterReadbackIsReady(resource) != 0;
+		}
+	}
+
+	internal readonly IntPtr resource;
+	internal bool disposed = false;
+
+	internal TextureReadback(Texture texture)
+	{
+		resource = Platform.FosterTextureGetDataAsync(texture.resource);
+		if (resource == IntPtr.Zero)
+			throw new Exception("Failed to read back Texture");
+
+		Texture = texture;
+		MemorySize = texture.MemorySize;
+
+		Graphics.Resources.RegisterAllocated(this, resource, Platform.FosterReadbackDestroy);
+	}
+
+	~TextureReadback()
+	{
+		Dispose(false);
+	}
+
+	/// <summary>
+	/// Writes the read back data to the given buffer if it's ready, without stalling
+	/// </summary>
+	public bool TryGetData<T>(Span<T> data) where T : struct
+	{
+		if (!IsReady)
+			return false;
+		GetData(data);
+		return true;
+	}
+
+	/// <summary>
+	/// Writes the read back data to the given buffer, waiting on the GPU if it isn't ready yet
+	/// </summary>
+	public unsafe void GetData<T>(Span<T> data) where T : struct
+	{
+		if (IsDisposed)
+			throw new Exception("Resource is Disposed");
+
+		if (Unsafe.SizeOf<T>() * data.Length < MemorySize)
+			throw new Exception("Data Buffer is smaller than the Size of the Texture");
+
+		fixed (byte* ptr = MemoryMarshal.AsBytes(data))
+		{
+			int length = Unsafe.SizeOf<T>() * data.Length;
+			Platform.FosterReadbackGetData(resource, ptr, length);
+		}
+	}
+
+	public void Dispose()
+	{
+		Dispose(true);
+		GC.SuppressFinalize(this);
+	}
+
+	private void Dispose(bool disposing)
+	{
+		if (!disposed)
+		{
+			disposed = true;
+			Graphics.Resources.RequestDelete(resource);
+		}
+	}
+}
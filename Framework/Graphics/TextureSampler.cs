@@ -6,5 +6,6 @@ namespace Foster.Framework;
 public readonly record struct TextureSampler(
 	TextureFilter Filter,
 	TextureWrap WrapX,
-	TextureWrap WrapY
+	TextureWrap WrapY,
+	int Anisotropy = 0
 );
@@ -31,6 +31,12 @@ internal static partial class Platform
 		ControllerAxis
 	}
 
+	public enum FosterCommandType : int
+	{
+		Draw,
+		Clear,
+	}
+
 	[StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
 	public struct FosterDesc
 	{
@@ -40,6 +46,7 @@ internal static partial class Platform
 		public int height;
 		public Renderers renderer;
 		public FosterFlags flags;
+		public int backbufferSamples;
 	}
 
 	[StructLayout(LayoutKind.Explicit)]
@@ -114,6 +121,7 @@ internal static partial class Platform
 		public nint name;
 		public UniformType type;
 		public int arrayElements;
+		public int bufferIndex;
 	}
 
 	[StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
@@ -121,6 +129,7 @@ internal static partial class Platform
 	{
 		public string vertex;
 		public string fragment;
+		public string? defines;
 	}
 
 	[StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
@@ -129,6 +138,15 @@ internal static partial class Platform
 		public int X = x, Y = y, W = w, H = h;
 	}
 
+	[StructLayout(LayoutKind.Sequential)]
+	public struct FosterPipelineDesc
+	{
+		public DepthCompare compare;
+		public int depthMask;
+		public CullMode cull;
+		public BlendMode blend;
+	}
+
 	[StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
 	public struct FosterDrawCommand
 	{
@@ -141,14 +159,27 @@ internal static partial class Platform
 		public FosterRect scissor;
 		public int indexStart;
 		public int indexCount;
+		public int baseVertex;
 		public int instanceCount;
+		public int instanceStart;
 		public DepthCompare compare;
 		public int depthMask;
 		public CullMode cull;
 		public BlendMode blend;
+		public nint pipeline;
+		public nint uniformValues;
+		public nint uniformSamplers;
+		public nint uniformTextures;
+		public int transient;
+		public int transientVertexOffset;
+		public int transientIndexOffset;
+		public nint ranges;
+		public int rangeCount;
+		public ulong sortKey;
+		public int sortBarrier;
 	}
 
-	[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+	[StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
 	public struct FosterClearCommand
 	{
 		public nint target;
@@ -157,6 +188,15 @@ internal static partial class Platform
 		public float depth;
 		public int stencil;
 		public ClearMask mask;
+		public ClearMask discard;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct FosterCommand
+	{
+		public FosterCommandType type;
+		public FosterDrawCommand draw;
+		public FosterClearCommand clear;
 	}
 
 	public static unsafe string ParseUTF8(nint s)
@@ -231,6 +271,12 @@ internal static partial class Platform
 	[LibraryImport(DLL)]
 	public static partial int FosterGetMaxTextureSize();
 	[LibraryImport(DLL)]
+	public static partial void FosterSetUploadBudget(int bytesPerFrame);
+	[LibraryImport(DLL)]
+	public static partial int FosterGetPendingUploadSize();
+	[LibraryImport(DLL)]
+	public static partial void FosterGetFrameStats(out FrameStats stats);
+	[LibraryImport(DLL)]
 	public static partial void FosterSetFlags(FosterFlags flags);
 	[LibraryImport(DLL)]
 	public static partial void FosterSetCentered();
@@ -267,21 +313,47 @@ internal static partial class Platform
 	[LibraryImport(DLL)]
 	public static partial Renderers FosterGetRenderer();
 	[LibraryImport(DLL)]
-	public static partial nint FosterTextureCreate(int width, int height, TextureFormat format);
+	public static partial nint FosterTextureCreate(int width, int height, int mipLevels, TextureFormat format);
+	[LibraryImport(DLL)]
+	public static partial nint FosterTextureCreateArray(int width, int height, int layers, int mipLevels, TextureFormat format);
 	[LibraryImport(DLL)]
 	public static unsafe partial void FosterTextureSetData(nint texture, void* data, int length);
 	[LibraryImport(DLL)]
+	public static unsafe partial void FosterTextureSetLayerData(nint texture, int layer, void* data, int length);
+	[LibraryImport(DLL)]
+	public static unsafe partial void FosterTextureSetLevelData(nint texture, int level, void* data, int length);
+	[LibraryImport(DLL)]
+	public static partial void FosterTextureGenerateMipmaps(nint texture);
+	[LibraryImport(DLL)]
+	public static unsafe partial void FosterTextureSetDataRect(nint texture, int x, int y, int w, int h, void* data, int stride);
+	[LibraryImport(DLL)]
+	public static unsafe partial void FosterTextureSetDataAsync(nint texture, int x, int y, int w, int h, void* data, int stride);
+	[LibraryImport(DLL)]
 	public static unsafe partial void FosterTextureGetData(nint texture, void* data, int length);
 	[LibraryImport(DLL)]
+	public static partial nint FosterTextureGetDataAsync(nint texture);
+	[LibraryImport(DLL)]
+	public static partial byte FosterReadbackIsReady(nint readback);
+	[LibraryImport(DLL)]
+	public static unsafe partial void FosterReadbackGetData(nint readback, void* data, int length);
+	[LibraryImport(DLL)]
+	public static partial void FosterReadbackDestroy(nint readback);
+	[LibraryImport(DLL)]
 	public static partial void FosterTextureDestroy(nint texture);
 	[LibraryImport(DLL)]
-	public static partial nint FosterTargetCreate(int width, int height, TextureFormat[] formats, int formatCount);
+	public static partial nint FosterTargetCreate(int width, int height, int samples, TextureFormat[] formats, int formatCount);
+	[LibraryImport(DLL)]
+	public static partial void FosterTargetResolve(nint target);
 	[LibraryImport(DLL)]
 	public static partial nint FosterTargetGetAttachment(nint target, int index);
 	[LibraryImport(DLL)]
 	public static partial void FosterTargetDestroy(nint target);
 	[DllImport(DLL)]
 	public static extern nint FosterShaderCreate(ref FosterShaderData data);
+	[DllImport(DLL)]
+	public static extern nint FosterShaderCreateAsync(ref FosterShaderData data);
+	[LibraryImport(DLL)]
+	public static partial byte FosterShaderIsReady(nint shader);
 	[LibraryImport(DLL)]
 	public static unsafe partial void FosterShaderGetUniforms(IntPtr shader, FosterUniformInfo* output, out int count, int max);
 	[LibraryImport(DLL)]
@@ -291,9 +363,15 @@ internal static partial class Platform
 	[LibraryImport(DLL)]
 	public static unsafe partial void FosterShaderSetSampler(IntPtr shader, int index, TextureSampler* values);
 	[LibraryImport(DLL)]
+	public static unsafe partial void FosterShaderApplyUniforms(IntPtr shader, float* values, TextureSampler* samplers, IntPtr* textures);
+	[LibraryImport(DLL)]
 	public static partial void FosterShaderDestroy(IntPtr shader);
 	[LibraryImport(DLL)]
-	public static partial nint FosterMeshCreate();
+	public static partial nint FosterPipelineCreate(in FosterPipelineDesc desc);
+	[LibraryImport(DLL)]
+	public static partial void FosterPipelineDestroy(nint pipeline);
+	[LibraryImport(DLL)]
+	public static partial nint FosterMeshCreate(MeshUsage usage);
 	[LibraryImport(DLL)]
 	public static partial void FosterMeshSetVertexFormat(nint mesh, ref FosterVertexFormat format);
 	[LibraryImport(DLL)]
@@ -303,11 +381,25 @@ internal static partial class Platform
 	[LibraryImport(DLL)]
 	public static partial void FosterMeshSetIndexData(nint mesh, nint data, int dataSize, int dataDestOffset);
 	[LibraryImport(DLL)]
+	public static partial void FosterMeshSetInstanceFormat(nint mesh, ref FosterVertexFormat format);
+	[LibraryImport(DLL)]
+	public static partial void FosterMeshSetInstanceData(nint mesh, nint data, int dataSize, int dataDestOffset);
+	[LibraryImport(DLL)]
 	public static partial void FosterMeshDestroy(nint mesh);
 	[LibraryImport(DLL)]
+	public static partial nint FosterTransientAllocVertices(int dataSize, out int offset);
+	[LibraryImport(DLL)]
+	public static partial nint FosterTransientAllocIndices(int dataSize, out int offset);
+	[LibraryImport(DLL)]
+	public static partial byte FosterTransientAllocGeometry(int vertexSize, int indexSize, out nint vertices, out nint indices, out int vertexOffset, out int indexOffset);
+	[LibraryImport(DLL)]
 	public static unsafe partial void FosterDraw(FosterDrawCommand* command);
 	[LibraryImport(DLL)]
 	public static unsafe partial void FosterClear(FosterClearCommand* command);
+	[LibraryImport(DLL)]
+	public static unsafe partial void FosterSubmitCommands(FosterCommand* commands, int count);
+	[LibraryImport(DLL)]
+	public static unsafe partial void FosterSubmitSortedCommands(FosterCommand* commands, int count);
 
 	// Non-Foster Calls:
 
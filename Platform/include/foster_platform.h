@@ -20,6 +20,7 @@
 #define FOSTER_MAX_VERTEX_FORMAT_ELEMENTS 16
 #define FOSTER_MAX_UNIFORM_NAME 64
 #define FOSTER_MAX_UNIFORM_TEXTURES 32
+#define FOSTER_MAX_UNIFORM_BLOCKS 16
 #define FOSTER_MAX_CONTROLLERS 32
 
 typedef uint8_t FosterBool;
@@ -29,6 +30,7 @@ typedef enum FosterRenderers
 	FOSTER_RENDERER_NONE,
 	FOSTER_RENDERER_D3D11,
 	FOSTER_RENDERER_OPENGL,
+	FOSTER_RENDERER_NULL,
 } FosterRenderers;
 
 typedef enum FosterFlags
@@ -346,7 +348,8 @@ typedef enum FosterBlendMask
 typedef enum FosterTextureFilter
 {
 	FOSTER_TEXTURE_FILTER_NEAREST,
-	FOSTER_TEXTURE_FILTER_LINEAR
+	FOSTER_TEXTURE_FILTER_LINEAR,
+	FOSTER_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR,
 } FosterTextureFilter;
 
 typedef enum FosterTextureWrap
@@ -362,6 +365,12 @@ typedef enum FosterTextureFormat
 	FOSTER_TEXTURE_FORMAT_R8G8B8A8,
 	FOSTER_TEXTURE_FORMAT_R8,
 	FOSTER_TEXTURE_FORMAT_DEPTH24_STENCIL8,
+	FOSTER_TEXTURE_FORMAT_R8G8,
+	FOSTER_TEXTURE_FORMAT_R16F,
+	FOSTER_TEXTURE_FORMAT_R16G16B16A16F,
+	FOSTER_TEXTURE_FORMAT_R32F,
+	FOSTER_TEXTURE_FORMAT_DEPTH16,
+	FOSTER_TEXTURE_FORMAT_DEPTH32F,
 } FosterTextureFormat;
 
 typedef enum FosterClearMask
@@ -383,7 +392,8 @@ typedef enum FosterUniformType
 	FOSTER_UNIFORM_TYPE_MAT3X2,
 	FOSTER_UNIFORM_TYPE_MAT4X4,
 	FOSTER_UNIFORM_TYPE_TEXTURE2D,
-	FOSTER_UNIFORM_TYPE_SAMPLER2D
+	FOSTER_UNIFORM_TYPE_SAMPLER2D,
+	FOSTER_UNIFORM_TYPE_TEXTURE2D_ARRAY
 } FosterUniformType;
 
 typedef enum FosterVertexType
@@ -407,6 +417,16 @@ typedef enum FosterIndexFormat
 	FOSTER_INDEX_FORMAT_THIRTY_TWO
 } FosterIndexFormat;
 
+typedef enum FosterMeshUsage
+{
+	// uploaded once and drawn many times
+	FOSTER_MESH_USAGE_STATIC,
+	// updated occasionally
+	FOSTER_MESH_USAGE_DYNAMIC,
+	// rewritten every frame or so
+	FOSTER_MESH_USAGE_STREAM
+} FosterMeshUsage;
+
 typedef enum FosterLogLevel
 {
 	FOSTER_LOG_LEVEL_INFO,
@@ -442,6 +462,12 @@ typedef enum FosterEventType
 	FOSTER_EVENT_TYPE_CONTROLLER_AXIS,
 } FosterEventType;
 
+typedef enum FosterCommandType
+{
+	FOSTER_COMMAND_TYPE_DRAW,
+	FOSTER_COMMAND_TYPE_CLEAR,
+} FosterCommandType;
+
 typedef void (FOSTER_CALL * FosterLogFn)(const char *msg, FosterLogLevel level);
 typedef void (FOSTER_CALL * FosterWriteFn)(void *context, void *data, int size);
 
@@ -449,6 +475,8 @@ typedef struct FosterTexture FosterTexture;
 typedef struct FosterTarget FosterTarget; 
 typedef struct FosterShader FosterShader; 
 typedef struct FosterMesh FosterMesh; 
+typedef struct FosterReadback FosterReadback; 
+typedef struct FosterPipeline FosterPipeline; 
 
 typedef struct FosterDesc
 {
@@ -458,6 +486,9 @@ typedef struct FosterDesc
 	int height;
 	FosterRenderers renderer;
 	FosterFlags flags;
+
+	// multisample antialiasing samples for the back buffer, or 0 to disable it
+	int backbufferSamples;
 } FosterDesc;
 
 typedef union FosterEvent
@@ -517,6 +548,9 @@ typedef struct FosterShaderData
 {
 	void* vertexShader;
 	void* fragmentShader;
+
+	// optional line separated list of macros to define, ie "FOG\nLIGHTS 4"
+	const char* defines;
 } FosterShaderData;
 
 typedef struct FosterTextureSampler
@@ -524,6 +558,9 @@ typedef struct FosterTextureSampler
 	FosterTextureFilter filter;
 	FosterTextureWrap wrapX;
 	FosterTextureWrap wrapY;
+
+	// maximum anisotropic filtering samples, or 0 to disable it
+	int anisotropy;
 } FosterTextureSampler;
 
 typedef struct FosterVertexFormatElement
@@ -546,6 +583,8 @@ typedef struct FosterUniformInfo
 	const char* name;
 	FosterUniformType type;
 	int arrayElements;
+	// index of the Uniform Block the uniform belongs to, or -1
+	int bufferIndex;
 } FosterUniformInfo;
 
 typedef struct FosterBlend
@@ -560,6 +599,23 @@ typedef struct FosterBlend
 	uint32_t rgba;
 } FosterBlend;
 
+typedef struct FosterDrawRange
+{
+	int indexStart;
+	int indexCount;
+	int baseVertex;
+} FosterDrawRange;
+
+// Fixed render state, baked into a FosterPipeline so draws using
+// the same state don't have to compare or convert it again.
+typedef struct FosterPipelineDesc
+{
+	FosterCompare compare;
+	int depthMask;
+	FosterCull cull;
+	FosterBlend blend;
+} FosterPipelineDesc;
+
 typedef struct FosterDrawCommand
 {
 	FosterTarget* target;
@@ -571,11 +627,40 @@ typedef struct FosterDrawCommand
 	FosterRect scissor;
 	int indexStart;
 	int indexCount;
+	int baseVertex;
 	int instanceCount;
+	int instanceStart;
 	FosterCompare compare;
 	int depthMask;
 	FosterCull cull;
 	FosterBlend blend;
+
+	// If set, the Pipeline's state is used in place of compare, depthMask, cull and blend
+	FosterPipeline* pipeline;
+
+	// Optional uniform values applied to the shader before drawing.
+	// Values are packed in the order reported by FosterShaderGetUniforms,
+	// with each uniform taking up its component count times array elements.
+	float* uniformValues;
+	FosterTextureSampler* uniformSamplers;
+	FosterTexture** uniformTextures;
+
+	// If set, vertices and indices are read from the transient buffers at the
+	// byte offsets returned by FosterTransientAllocVertices/Indices/Geometry,
+	// instead of from the mesh. The mesh's vertex and index formats are still used.
+	int transient;
+	int transientVertexOffset;
+	int transientIndexOffset;
+
+	// If set, every range is drawn with the same state in a single call,
+	// in place of indexStart, indexCount and baseVertex.
+	FosterDrawRange* ranges;
+	int rangeCount;
+
+	// Used by FosterSubmitSortedCommands, which draws lower keys first.
+	// Draws are never sorted across a barrier, a clear, or a change of target.
+	uint64_t sortKey;
+	int sortBarrier;
 } FosterDrawCommand;
 
 typedef struct FosterClearCommand
@@ -586,8 +671,36 @@ typedef struct FosterClearCommand
 	float depth;
 	int stencil;
 	FosterClearMask mask;
+
+	// buffers whose contents are no longer needed, which are invalidated before clearing.
+	// at the start of a pass this skips loading them, and after the last draw to a
+	// target it skips storing them, which saves bandwidth on tiled GPUs.
+	FosterClearMask discard;
 } FosterClearCommand;
 
+typedef struct FosterCommand
+{
+	FosterCommandType type;
+	FosterDrawCommand draw;
+	FosterClearCommand clear;
+} FosterCommand;
+
+// Counters for the work submitted to the renderer, reset every FosterBeginFrame
+typedef struct FosterFrameStats
+{
+	int drawCommands;
+	int drawCalls;
+	int triangles;
+	int clears;
+	int stateChanges;
+	int programBinds;
+	int textureBinds;
+	int samplerBinds;
+	int framebufferBinds;
+	int bufferUploadBytes;
+	int textureUploadBytes;
+} FosterFrameStats;
+
 typedef struct FosterFont FosterFont;
 
 #if __cplusplus
@@ -620,6 +733,15 @@ FOSTER_API void FosterGetDisplaySize(int* width, int* height);
 
 FOSTER_API int FosterGetMaxTextureSize();
 
+// Limits how many bytes of asynchronous Texture uploads are performed each frame, or 0 for no limit
+FOSTER_API void FosterSetUploadBudget(int bytesPerFrame);
+
+// The number of bytes of asynchronous Texture uploads waiting for a later frame
+FOSTER_API int FosterGetPendingUploadSize();
+
+// The renderer's counters for the current frame, so far
+FOSTER_API void FosterGetFrameStats(FosterFrameStats* stats);
+
 FOSTER_API void FosterSetFlags(FosterFlags flags);
 
 FOSTER_API void FosterSetCentered();
@@ -656,22 +778,70 @@ FOSTER_API void FosterFontFree(FosterFont* font);
 
 FOSTER_API FosterRenderers FosterGetRenderer();
 
-FOSTER_API FosterTexture* FosterTextureCreate(int width, int height, FosterTextureFormat format);
+// Creates a Texture with the given number of mip levels, which must be at least 1
+FOSTER_API FosterTexture* FosterTextureCreate(int width, int height, int mipLevels, FosterTextureFormat format);
+
+FOSTER_API FosterTexture* FosterTextureCreateArray(int width, int height, int layers, int mipLevels, FosterTextureFormat format);
 
 FOSTER_API void FosterTextureSetData(FosterTexture* texture, void* data, int length);
 
+FOSTER_API void FosterTextureSetLayerData(FosterTexture* texture, int layer, void* data, int length);
+
+// Sets the data of a single mip level, including every layer of a Texture Array
+FOSTER_API void FosterTextureSetLevelData(FosterTexture* texture, int level, void* data, int length);
+
+// Generates every mip level below the first from its current contents
+FOSTER_API void FosterTextureGenerateMipmaps(FosterTexture* texture);
+
+// Sets a rectangle of the Texture. Stride is the number of bytes between
+// the start of each row in data, or 0 if the rows are tightly packed.
+FOSTER_API void FosterTextureSetDataRect(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride);
+
+// Sets a rectangle of the Texture through a staging buffer, without waiting on the GPU.
+// The data is copied immediately, but may not be uploaded until a later frame if the
+// staging buffer or the upload budget has run out.
+FOSTER_API void FosterTextureSetDataAsync(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride);
+
 FOSTER_API void FosterTextureGetData(FosterTexture* texture, void* data, int length);
 
+// Starts copying the Texture's data back to the CPU without waiting on the GPU.
+// Poll FosterReadbackIsReady, and then copy the data out with FosterReadbackGetData.
+FOSTER_API FosterReadback* FosterTextureGetDataAsync(FosterTexture* texture);
+
+FOSTER_API FosterBool FosterReadbackIsReady(FosterReadback* readback);
+
+// Copies the read back data, waiting on the GPU if it isn't ready yet
+FOSTER_API void FosterReadbackGetData(FosterReadback* readback, void* data, int length);
+
+FOSTER_API void FosterReadbackDestroy(FosterReadback* readback);
+
 FOSTER_API void FosterTextureDestroy(FosterTexture* texture);
 
-FOSTER_API FosterTarget* FosterTargetCreate(int width, int height, FosterTextureFormat* attachments, int attachmentCount);
+// Creates a Target. With more than 1 sample it's drawn to multisampled buffers,
+// and FosterTargetResolve must be called before the attachments are used.
+FOSTER_API FosterTarget* FosterTargetCreate(int width, int height, int samples, FosterTextureFormat* attachments, int attachmentCount);
 
 FOSTER_API FosterTexture* FosterTargetGetAttachment(FosterTarget* target, int index);
 
+// Resolves a multisampled Target's samples into its attachments
+FOSTER_API void FosterTargetResolve(FosterTarget* target);
+
 FOSTER_API void FosterTargetDestroy(FosterTarget* target);
 
+// Creates a Shader. Shaders with the same sources & defines share one program,
+// and where the driver supports it linked programs are cached in the user path
+// so later runs can skip compiling them. Variants with defines are compiled on
+// first use, so compile errors are only logged and the Shader draws nothing.
 FOSTER_API FosterShader* FosterShaderCreate(FosterShaderData* data);
 
+// Creates a Shader without waiting for the driver to compile it, so many can be
+// compiled at once. Using it before it's ready blocks until it's compiled, and
+// if compilation fails the error is logged and the Shader draws nothing.
+FOSTER_API FosterShader* FosterShaderCreateAsync(FosterShaderData* data);
+
+// Returns if an async Shader has finished compiling
+FOSTER_API FosterBool FosterShaderIsReady(FosterShader* shader);
+
 FOSTER_API void FosterShaderGetUniforms(FosterShader* shader, FosterUniformInfo* output, int* count, int max);
 
 FOSTER_API void FosterShaderSetUniform(FosterShader* shader, int index, float* values);
@@ -680,9 +850,17 @@ FOSTER_API void FosterShaderSetTexture(FosterShader* shader, int index, FosterTe
 
 FOSTER_API void FosterShaderSetSampler(FosterShader* shader, int index, FosterTextureSampler* values);
 
+// Sets every Uniform at once, using the same packed layout as FosterDrawCommand.
+// Values that haven't changed since they were last set are skipped.
+FOSTER_API void FosterShaderApplyUniforms(FosterShader* shader, float* values, FosterTextureSampler* samplers, FosterTexture** textures);
+
 FOSTER_API void FosterShaderDestroy(FosterShader* shader);
 
-FOSTER_API FosterMesh* FosterMeshCreate();
+FOSTER_API FosterPipeline* FosterPipelineCreate(FosterPipelineDesc* desc);
+
+FOSTER_API void FosterPipelineDestroy(FosterPipeline* pipeline);
+
+FOSTER_API FosterMesh* FosterMeshCreate(FosterMeshUsage usage);
 
 FOSTER_API void FosterMeshSetVertexFormat(FosterMesh* mesh, FosterVertexFormat* format);
 
@@ -692,12 +870,35 @@ FOSTER_API void FosterMeshSetIndexFormat(FosterMesh* mesh, FosterIndexFormat for
 
 FOSTER_API void FosterMeshSetIndexData(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset);
 
+// Sets the format of the per-instance vertex stream, whose attributes advance once per instance
+FOSTER_API void FosterMeshSetInstanceFormat(FosterMesh* mesh, FosterVertexFormat* format);
+
+FOSTER_API void FosterMeshSetInstanceData(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset);
+
 FOSTER_API void FosterMeshDestroy(FosterMesh* mesh);
 
+// Returns a pointer to write transient vertex data to, which is only valid until the end of the frame.
+// Returns NULL if there isn't enough room left this frame, in which case the buffer grows next frame.
+FOSTER_API void* FosterTransientAllocVertices(int dataSize, int* offset);
+
+// Returns a pointer to write transient index data to, which is only valid until the end of the frame.
+// Returns NULL if there isn't enough room left this frame, in which case the buffer grows next frame.
+FOSTER_API void* FosterTransientAllocIndices(int dataSize, int* offset);
+
+// Allocates transient vertex and index data together, only valid until the end of the frame.
+// Returns false without allocating either if there isn't enough room for both this frame.
+FOSTER_API FosterBool FosterTransientAllocGeometry(int vertexSize, int indexSize, void** vertices, void** indices, int* vertexOffset, int* indexOffset);
+
 FOSTER_API void FosterDraw(FosterDrawCommand* command);
 
 FOSTER_API void FosterClear(FosterClearCommand* clear);
 
+FOSTER_API void FosterSubmitCommands(FosterCommand* commands, int count);
+
+// Submits commands after stable sorting each run of draws by their sortKey.
+// Draws with equal keys are kept in the order they were given.
+FOSTER_API void FosterSubmitSortedCommands(FosterCommand* commands, int count);
+
 #if __cplusplus
 }
 #endif
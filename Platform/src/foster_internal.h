@@ -25,6 +25,11 @@ typedef struct
 	FosterLogFn logFn;
 	FosterLogFilter logFilter;
 	FosterBool polledMouseMovement;
+
+	// scratch memory for FosterSubmitSortedCommands
+	FosterSortEntry* sortEntries;
+	FosterCommand* sortCommands;
+	int sortCapacity;
 } FosterState;
 
 FosterState* FosterGetState();
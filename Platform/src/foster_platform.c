@@ -64,6 +64,9 @@ void FosterStartup(FosterDesc desc)
 	fstate.device.renderer = FOSTER_RENDERER_NONE;
 	fstate.clipboardText = NULL;
 	fstate.userPath = NULL;
+	fstate.sortEntries = NULL;
+	fstate.sortCommands = NULL;
+	fstate.sortCapacity = 0;
 
 	if (fstate.desc.width <= 0 || fstate.desc.height <= 0)
 	{
@@ -91,6 +94,10 @@ void FosterStartup(FosterDesc desc)
 	// by default allow controller presses while unfocused, let game decide if it should handle them
 	SDL_SetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS, "1");
 
+	// the null renderer doesn't need a display, so avoid requiring one
+	if (fstate.desc.renderer == FOSTER_RENDERER_NULL)
+		SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
 	// initialize SDL
 	int sdl_init_flags = SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_EVENTS | SDL_INIT_JOYSTICK | SDL_INIT_GAMECONTROLLER;
 	if (SDL_Init(sdl_init_flags) != 0)
@@ -368,6 +375,11 @@ void FosterShutdown()
 		SDL_free(fstate.clipboardText);
 	if (fstate.userPath != NULL)
 		SDL_free(fstate.userPath);
+	SDL_free(fstate.sortEntries);
+	SDL_free(fstate.sortCommands);
+	fstate.sortEntries = NULL;
+	fstate.sortCommands = NULL;
+	fstate.sortCapacity = 0;
 	fstate.clipboardText = NULL;
 	fstate.running = false;
 	SDL_DestroyWindow(fstate.window);
@@ -422,6 +434,24 @@ int FosterGetMaxTextureSize()
 	return fstate.device.getMaxTextureSize();
 }
 
+void FosterSetUploadBudget(int bytesPerFrame)
+{
+	FOSTER_ASSERT_RUNNING(FosterSetUploadBudget);
+	fstate.device.setUploadBudget(bytesPerFrame);
+}
+
+int FosterGetPendingUploadSize()
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterGetPendingUploadSize, 0);
+	return fstate.device.getPendingUploadSize();
+}
+
+void FosterGetFrameStats(FosterFrameStats* stats)
+{
+	FOSTER_ASSERT_RUNNING(FosterGetFrameStats);
+	fstate.device.getFrameStats(stats);
+}
+
 void FosterSetFlags(FosterFlags flags)
 {
 	FOSTER_ASSERT_RUNNING(FosterSetFlags);
@@ -586,10 +616,16 @@ FosterRenderers FosterGetRenderer()
 	return fstate.device.renderer;
 }
 
-FosterTexture* FosterTextureCreate(int width, int height, FosterTextureFormat format)
+FosterTexture* FosterTextureCreate(int width, int height, int mipLevels, FosterTextureFormat format)
 {
 	FOSTER_ASSERT_RUNNING_RET(FosterTextureCreate, NULL);
-	return fstate.device.textureCreate(width, height, format);
+	return fstate.device.textureCreate(width, height, mipLevels, format);
+}
+
+FosterTexture* FosterTextureCreateArray(int width, int height, int layers, int mipLevels, FosterTextureFormat format)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterTextureCreateArray, NULL);
+	return fstate.device.textureCreateArray(width, height, layers, mipLevels, format);
 }
 
 void FosterTextureSetData(FosterTexture* texture, void* data, int length)
@@ -598,22 +634,76 @@ void FosterTextureSetData(FosterTexture* texture, void* data, int length)
 	fstate.device.textureSetData(texture, data, length);
 }
 
+void FosterTextureSetLayerData(FosterTexture* texture, int layer, void* data, int length)
+{
+	FOSTER_ASSERT_RUNNING(FosterTextureSetLayerData);
+	fstate.device.textureSetLayerData(texture, layer, data, length);
+}
+
+void FosterTextureSetLevelData(FosterTexture* texture, int level, void* data, int length)
+{
+	FOSTER_ASSERT_RUNNING(FosterTextureSetLevelData);
+	fstate.device.textureSetLevelData(texture, level, data, length);
+}
+
+void FosterTextureGenerateMipmaps(FosterTexture* texture)
+{
+	FOSTER_ASSERT_RUNNING(FosterTextureGenerateMipmaps);
+	fstate.device.textureGenerateMipmaps(texture);
+}
+
+void FosterTextureSetDataRect(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride)
+{
+	FOSTER_ASSERT_RUNNING(FosterTextureSetDataRect);
+	fstate.device.textureSetDataRect(texture, x, y, w, h, data, stride);
+}
+
+void FosterTextureSetDataAsync(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride)
+{
+	FOSTER_ASSERT_RUNNING(FosterTextureSetDataAsync);
+	fstate.device.textureSetDataAsync(texture, x, y, w, h, data, stride);
+}
+
 void FosterTextureGetData(FosterTexture* texture, void* data, int length)
 {
 	FOSTER_ASSERT_RUNNING(FosterTextureGetData);
 	fstate.device.textureGetData(texture, data, length);
 }
 
+FosterReadback* FosterTextureGetDataAsync(FosterTexture* texture)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterTextureGetDataAsync, NULL);
+	return fstate.device.textureGetDataAsync(texture);
+}
+
+FosterBool FosterReadbackIsReady(FosterReadback* readback)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterReadbackIsReady, 0);
+	return fstate.device.readbackIsReady(readback);
+}
+
+void FosterReadbackGetData(FosterReadback* readback, void* data, int length)
+{
+	FOSTER_ASSERT_RUNNING(FosterReadbackGetData);
+	fstate.device.readbackGetData(readback, data, length);
+}
+
+void FosterReadbackDestroy(FosterReadback* readback)
+{
+	FOSTER_ASSERT_RUNNING(FosterReadbackDestroy);
+	fstate.device.readbackDestroy(readback);
+}
+
 void FosterTextureDestroy(FosterTexture* texture)
 {
 	FOSTER_ASSERT_RUNNING(FosterTextureDestroy);
 	fstate.device.textureDestroy(texture);
 }
 
-FosterTarget* FosterTargetCreate(int width, int height, FosterTextureFormat* attachments, int attachmentCount)
+FosterTarget* FosterTargetCreate(int width, int height, int samples, FosterTextureFormat* attachments, int attachmentCount)
 {
 	FOSTER_ASSERT_RUNNING_RET(FosterTargetCreate, NULL);
-	return fstate.device.targetCreate(width, height, attachments, attachmentCount);
+	return fstate.device.targetCreate(width, height, samples, attachments, attachmentCount);
 }
 
 FosterTexture* FosterTargetGetAttachment(FosterTarget* target, int index)
@@ -626,6 +716,12 @@ FosterTexture* FosterTargetGetAttachment(FosterTarget* target, int index)
 	return fstate.device.targetGetAttachment(target, index);
 }
 
+void FosterTargetResolve(FosterTarget* target)
+{
+	FOSTER_ASSERT_RUNNING(FosterTargetResolve);
+	fstate.device.targetResolve(target);
+}
+
 void FosterTargetDestroy(FosterTarget* target)
 {
 	FOSTER_ASSERT_RUNNING(FosterTargetDestroy);
@@ -638,6 +734,18 @@ FosterShader* FosterShaderCreate(FosterShaderData* data)
 	return fstate.device.shaderCreate(data);
 }
 
+FosterShader* FosterShaderCreateAsync(FosterShaderData* data)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterShaderCreateAsync, NULL);
+	return fstate.device.shaderCreateAsync(data);
+}
+
+FosterBool FosterShaderIsReady(FosterShader* shader)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterShaderIsReady, 0);
+	return fstate.device.shaderIsReady(shader);
+}
+
 void FosterShaderGetUniforms(FosterShader* shader, FosterUniformInfo* output, int* count, int max)
 {
 	FOSTER_ASSERT_RUNNING(FosterShaderGetUniforms);
@@ -662,16 +770,34 @@ void FosterShaderSetSampler(FosterShader* shader, int index, FosterTextureSample
 	fstate.device.shaderSetSampler(shader, index, values);
 }
 
+void FosterShaderApplyUniforms(FosterShader* shader, float* values, FosterTextureSampler* samplers, FosterTexture** textures)
+{
+	FOSTER_ASSERT_RUNNING(FosterShaderApplyUniforms);
+	fstate.device.shaderApplyUniforms(shader, values, samplers, textures);
+}
+
 void FosterShaderDestroy(FosterShader* shader)
 {
 	FOSTER_ASSERT_RUNNING(FosterShaderDestroy);
 	fstate.device.shaderDestroy(shader);
 }
 
-FosterMesh* FosterMeshCreate()
+FosterPipeline* FosterPipelineCreate(FosterPipelineDesc* desc)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterPipelineCreate, NULL);
+	return fstate.device.pipelineCreate(desc);
+}
+
+void FosterPipelineDestroy(FosterPipeline* pipeline)
+{
+	FOSTER_ASSERT_RUNNING(FosterPipelineDestroy);
+	fstate.device.pipelineDestroy(pipeline);
+}
+
+FosterMesh* FosterMeshCreate(FosterMeshUsage usage)
 {
 	FOSTER_ASSERT_RUNNING_RET(FosterMeshCreate, NULL);
-	return fstate.device.meshCreate();
+	return fstate.device.meshCreate(usage);
 }
 
 void FosterMeshSetVertexFormat(FosterMesh* mesh, FosterVertexFormat* format)
@@ -698,12 +824,42 @@ void FosterMeshSetIndexData(FosterMesh* mesh, void* data, int dataSize, int data
 	fstate.device.meshSetIndexData(mesh, data, dataSize, dataDestOffset);
 }
 
+void FosterMeshSetInstanceFormat(FosterMesh* mesh, FosterVertexFormat* format)
+{
+	FOSTER_ASSERT_RUNNING(FosterMeshSetInstanceFormat);
+	fstate.device.meshSetInstanceFormat(mesh, format);
+}
+
+void FosterMeshSetInstanceData(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
+{
+	FOSTER_ASSERT_RUNNING(FosterMeshSetInstanceData);
+	fstate.device.meshSetInstanceData(mesh, data, dataSize, dataDestOffset);
+}
+
 void FosterMeshDestroy(FosterMesh* mesh)
 {
 	FOSTER_ASSERT_RUNNING(FosterMeshDestroy);
 	fstate.device.meshDestroy(mesh);
 }
 
+void* FosterTransientAllocVertices(int dataSize, int* offset)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterTransientAllocVertices, NULL);
+	return fstate.device.transientAllocVertices(dataSize, offset);
+}
+
+void* FosterTransientAllocIndices(int dataSize, int* offset)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterTransientAllocIndices, NULL);
+	return fstate.device.transientAllocIndices(dataSize, offset);
+}
+
+FosterBool FosterTransientAllocGeometry(int vertexSize, int indexSize, void** vertices, void** indices, int* vertexOffset, int* indexOffset)
+{
+	FOSTER_ASSERT_RUNNING_RET(FosterTransientAllocGeometry, 0);
+	return fstate.device.transientAllocGeometry(vertexSize, indexSize, vertices, indices, vertexOffset, indexOffset);
+}
+
 void FosterDraw(FosterDrawCommand* command)
 {
 	FOSTER_ASSERT_RUNNING(FosterDraw);
@@ -716,6 +872,61 @@ void FosterClear(FosterClearCommand* clear)
 	fstate.device.clear(clear);
 }
 
+void FosterSubmitCommands(FosterCommand* commands, int count)
+{
+	FOSTER_ASSERT_RUNNING(FosterSubmitCommands);
+	fstate.device.submit(commands, count);
+}
+
+void FosterSubmitSortedCommands(FosterCommand* commands, int count)
+{
+	FOSTER_ASSERT_RUNNING(FosterSubmitSortedCommands);
+
+	if (count <= 1)
+	{
+		fstate.device.submit(commands, count);
+		return;
+	}
+
+	if (count > fstate.sortCapacity)
+	{
+		while (fstate.sortCapacity < count)
+			fstate.sortCapacity = fstate.sortCapacity > 0 ? fstate.sortCapacity * 2 : 256;
+		fstate.sortEntries = (FosterSortEntry*)SDL_realloc(fstate.sortEntries, sizeof(FosterSortEntry) * fstate.sortCapacity * 2);
+		fstate.sortCommands = (FosterCommand*)SDL_realloc(fstate.sortCommands, sizeof(FosterCommand) * fstate.sortCapacity);
+	}
+
+	int start = 0;
+	while (start < count)
+	{
+		// find the run of draws that may be reordered among themselves
+		int end = start + 1;
+		if (commands[start].type == FOSTER_COMMAND_TYPE_DRAW)
+		{
+			while (end < count &&
+				commands[end].type == FOSTER_COMMAND_TYPE_DRAW &&
+				commands[end].draw.target == commands[start].draw.target &&
+				!commands[end].draw.sortBarrier)
+				end++;
+		}
+
+		int length = end - start;
+		for (int i = 0; i < length; i++)
+		{
+			fstate.sortEntries[i].key = commands[start + i].type == FOSTER_COMMAND_TYPE_DRAW ? commands[start + i].draw.sortKey : 0;
+			fstate.sortEntries[i].index = start + i;
+		}
+
+		FosterSortEntry* sorted = FosterRadixSort(fstate.sortEntries, fstate.sortEntries + fstate.sortCapacity, length);
+		for (int i = 0; i < length; i++)
+			fstate.sortCommands[start + i] = commands[sorted[i].index];
+
+		start = end;
+	}
+
+	fstate.device.submit(fstate.sortCommands, count);
+}
+
 void FosterLog(FosterLogLevel level, const char* fmt, ...)
 {
 	if (fstate.logFilter == FOSTER_LOG_FILTER_IGNORE_ALL ||
@@ -1,4 +1,129 @@
 #include "foster_renderer.h"
+#include <SDL.h>
+
+// The number of mip levels in a full chain, down to 1x1
+int FosterTextureMaxMipLevels(int width, int height)
+{
+	int size = width > height ? width : height;
+	int levels = 1;
+	while (size > 1)
+	{
+		size >>= 1;
+		levels++;
+	}
+	return levels;
+}
+
+bool FosterTextureFormatIsDepth(FosterTextureFormat format)
+{
+	return
+		format == FOSTER_TEXTURE_FORMAT_DEPTH24_STENCIL8 ||
+		format == FOSTER_TEXTURE_FORMAT_DEPTH16 ||
+		format == FOSTER_TEXTURE_FORMAT_DEPTH32F;
+}
+
+// Copies shader source with a #define for each line of defines, placed after
+// the #version directive since that has to come first. The result must be freed.
+char* FosterShaderApplyDefines(const char* source, const char* defines)
+{
+	size_t sourceLength = SDL_strlen(source);
+	size_t definesLength = defines != NULL ? SDL_strlen(defines) : 0;
+
+	// each define needs "#define " and a line break, plus the "#line" reset
+	size_t lines = 1;
+	for (size_t i = 0; i < definesLength; i++)
+		if (defines[i] == '\n')
+			lines++;
+	size_t capacity = sourceLength + definesLength + lines * 10 + 32;
+	char* result = (char*)SDL_malloc(capacity);
+
+	if (definesLength == 0)
+	{
+		SDL_memcpy(result, source, sourceLength + 1);
+		return result;
+	}
+
+	// find the end of the #version line, if there is one
+	const char* insert = source;
+	while (*insert == ' ' || *insert == '\t' || *insert == '\r' || *insert == '\n')
+		insert++;
+	if (SDL_strncmp(insert, "#version", 8) == 0)
+	{
+		while (*insert != '\0' && *insert != '\n')
+			insert++;
+		if (*insert == '\n')
+			insert++;
+	}
+	else
+	{
+		insert = source;
+	}
+
+	size_t length = insert - source;
+	SDL_memcpy(result, source, length);
+
+	const char* it = defines;
+	while (*it != '\0')
+	{
+		const char* end = it;
+		while (*end != '\0' && *end != '\n')
+			end++;
+
+		if (end > it)
+		{
+			SDL_memcpy(result + length, "#define ", 8);
+			length += 8;
+			SDL_memcpy(result + length, it, end - it);
+			length += end - it;
+			result[length++] = '\n';
+		}
+
+		it = *end == '\n' ? end + 1 : end;
+	}
+
+	// keep error line numbers matching the original source
+	int versionLines = 0;
+	for (const char* c = source; c < insert; c++)
+		if (*c == '\n')
+			versionLines++;
+	length += SDL_snprintf(result + length, capacity - length, "#line %i\n", versionLines + 1);
+
+	SDL_memcpy(result + length, insert, sourceLength - (insert - source) + 1);
+	return result;
+}
+
+// Stable radix sort by key, a byte at a time, using temp as scratch space.
+// Bytes that every key shares are skipped, which is common for sort keys
+// that leave fields zeroed. Returns whichever array ends up sorted.
+FosterSortEntry* FosterRadixSort(FosterSortEntry* entries, FosterSortEntry* temp, int count)
+{
+	for (int shift = 0; shift < 64; shift += 8)
+	{
+		int offsets[256] = { 0 };
+		for (int i = 0; i < count; i++)
+			offsets[(entries[i].key >> shift) & 0xFF]++;
+
+		if (offsets[(entries[0].key >> shift) & 0xFF] == count)
+			continue;
+
+		int offset = 0;
+		for (int i = 0; i < 256; i++)
+		{
+			int bucket = offsets[i];
+			offsets[i] = offset;
+			offset += bucket;
+		}
+
+		for (int i = 0; i < count; i++)
+			temp[offsets[(entries[i].key >> shift) & 0xFF]++] = entries[i];
+
+		FosterSortEntry* swap = entries;
+		entries = temp;
+		temp = swap;
+	}
+
+	return entries;
+}
 
 bool FosterGetDevice(FosterRenderers preferred, FosterRenderDevice* device)
 {
@@ -23,6 +148,8 @@ bool FosterGetDevice(FosterRenderers preferred, FosterRenderDevice* device)
 			return FosterGetDevice_OpenGL(device);
 		case FOSTER_RENDERER_D3D11:
 			return FosterGetDevice_D3D11(device);
+		case FOSTER_RENDERER_NULL:
+			return FosterGetDevice_Null(device);
 	}
 
 	return false;
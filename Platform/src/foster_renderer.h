@@ -16,35 +16,73 @@ typedef struct FosterRenderDevice
 
 	int (*getMaxTextureSize)();
 	
-	FosterTexture* (*textureCreate)(int width, int height, FosterTextureFormat format);
+	FosterTexture* (*textureCreate)(int width, int height, int mipLevels, FosterTextureFormat format);
+	FosterTexture* (*textureCreateArray)(int width, int height, int layers, int mipLevels, FosterTextureFormat format);
 	void (*textureSetData)(FosterTexture* texture, void* data, int length);
+	void (*textureSetLayerData)(FosterTexture* texture, int layer, void* data, int length);
+	void (*textureSetLevelData)(FosterTexture* texture, int level, void* data, int length);
+	void (*textureGenerateMipmaps)(FosterTexture* texture);
+	void (*textureSetDataRect)(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride);
+	void (*textureSetDataAsync)(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride);
 	void (*textureGetData)(FosterTexture* texture, void* data, int length);
+	FosterReadback* (*textureGetDataAsync)(FosterTexture* texture);
+	FosterBool (*readbackIsReady)(FosterReadback* readback);
+	void (*readbackGetData)(FosterReadback* readback, void* data, int length);
+	void (*readbackDestroy)(FosterReadback* readback);
 	void (*textureDestroy)(FosterTexture* texture);
 
-	FosterTarget* (*targetCreate)(int width, int height, FosterTextureFormat* formats, int format_count);
+	void (*setUploadBudget)(int bytesPerFrame);
+	int (*getPendingUploadSize)();
+	void (*getFrameStats)(FosterFrameStats* stats);
+
+	FosterTarget* (*targetCreate)(int width, int height, int samples, FosterTextureFormat* formats, int format_count);
 	FosterTexture* (*targetGetAttachment)(FosterTarget* target, int index);
+	void (*targetResolve)(FosterTarget* target);
 	void (*targetDestroy)(FosterTarget* target);
 
 	FosterShader* (*shaderCreate)(FosterShaderData* data);
+	FosterShader* (*shaderCreateAsync)(FosterShaderData* data);
+	FosterBool (*shaderIsReady)(FosterShader* shader);
 	void (*shaderSetUniform)(FosterShader* shader, int index, float* values);
 	void (*shaderSetTexture)(FosterShader* shader, int index, FosterTexture** values);
 	void (*shaderSetSampler)(FosterShader* shader, int index, FosterTextureSampler* values);
+	void (*shaderApplyUniforms)(FosterShader* shader, float* values, FosterTextureSampler* samplers, FosterTexture** textures);
 	void (*shaderGetUniforms)(FosterShader* shader, FosterUniformInfo* output, int* count, int max);
 	void (*shaderDestroy)(FosterShader* shader);
 
-	FosterMesh* (*meshCreate)();
+	FosterPipeline* (*pipelineCreate)(FosterPipelineDesc* desc);
+	void (*pipelineDestroy)(FosterPipeline* pipeline);
+
+	FosterMesh* (*meshCreate)(FosterMeshUsage usage);
 	void (*meshSetVertexFormat)(FosterMesh* mesh, FosterVertexFormat* format);
 	void (*meshSetVertexData)(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset);
 	void (*meshSetIndexFormat)(FosterMesh* mesh, FosterIndexFormat format);
 	void (*meshSetIndexData)(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset);
+	void (*meshSetInstanceFormat)(FosterMesh* mesh, FosterVertexFormat* format);
+	void (*meshSetInstanceData)(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset);
 	void (*meshDestroy)(FosterMesh* mesh);
+	void* (*transientAllocVertices)(int dataSize, int* offset);
+	void* (*transientAllocIndices)(int dataSize, int* offset);
+	FosterBool (*transientAllocGeometry)(int vertexSize, int indexSize, void** vertices, void** indices, int* vertexOffset, int* indexOffset);
 
 	void (*draw)(FosterDrawCommand* command);
 	void (*clear)(FosterClearCommand* clear);
+	void (*submit)(FosterCommand* commands, int count);
 } FosterRenderDevice;
 
+typedef struct FosterSortEntry
+{
+	uint64_t key;
+	int index;
+} FosterSortEntry;
+
 bool FosterGetDevice(FosterRenderers preferred, FosterRenderDevice* device);
+int FosterTextureMaxMipLevels(int width, int height);
+bool FosterTextureFormatIsDepth(FosterTextureFormat format);
+char* FosterShaderApplyDefines(const char* source, const char* defines);
+FosterSortEntry* FosterRadixSort(FosterSortEntry* entries, FosterSortEntry* temp, int count);
 bool FosterGetDevice_D3D11(FosterRenderDevice* device);
 bool FosterGetDevice_OpenGL(FosterRenderDevice* device);
+bool FosterGetDevice_Null(FosterRenderDevice* device);
 
 #endif
@@ -0,0 +1,1325 @@
+#include "foster_renderer.h"
+#include "foster_internal.h"
+
+// The Null Renderer keeps all resources in CPU memory and validates every
+// command it receives, but never rasterizes anything. It's useful for
+// measuring CPU overhead and for running without a GPU or a display.
+
+#define FOSTER_NULL_MAX_TEXTURE_SIZE 16384
+#define FOSTER_NULL_MAX_TEXTURE_LAYERS 2048
+
+typedef struct FosterTexture_Null
+{
+	int width;
+	int height;
+	int layers;
+	int mipLevels;
+	FosterTextureFormat format;
+
+	// only the first mip level is kept, as nothing is ever sampled
+	unsigned char* data;
+	int dataSize;
+
+	// Shaders may still reference a texture after it has been disposed,
+	// so the same reference counting as the OpenGL renderer is used.
+	int refCount;
+	int disposed;
+} FosterTexture_Null;
+
+typedef struct FosterReadback_Null
+{
+	unsigned char* data;
+	int size;
+} FosterReadback_Null;
+
+typedef struct FosterTarget_Null
+{
+	int width;
+	int height;
+	int samples;
+	int attachmentCount;
+	FosterTexture_Null* attachments[FOSTER_MAX_TARGET_ATTACHMENTS];
+} FosterTarget_Null;
+
+typedef struct FosterUniform_Null
+{
+	char* name;
+	char* samplerName;
+	FosterUniformType type;
+	int arrayElements;
+	int samplerIndex;
+	int valueIndex;
+	int bufferIndex;
+} FosterUniform_Null;
+
+typedef struct FosterShader_Null
+{
+	int uniformCount;
+	int samplerCount;
+	int valueCount;
+	int blockCount;
+	FosterUniform_Null* uniforms;
+	float* values;
+	FosterTexture_Null* textures[FOSTER_MAX_UNIFORM_TEXTURES];
+	FosterTextureSampler samplers[FOSTER_MAX_UNIFORM_TEXTURES];
+} FosterShader_Null;
+
+typedef struct FosterPipeline_Null
+{
+	FosterPipelineDesc desc;
+} FosterPipeline_Null;
+
+typedef struct FosterMesh_Null
+{
+	unsigned char* vertexData;
+	int vertexDataSize;
+	unsigned char* indexData;
+	int indexDataSize;
+	unsigned char* instanceData;
+	int instanceDataSize;
+	int indexSize;
+	int vertexStride;
+	int instanceStride;
+	FosterMeshUsage usage;
+} FosterMesh_Null;
+
+typedef struct FosterTransient_Null
+{
+	unsigned char* data;
+	int size;
+	int offset;
+	int overflow;
+} FosterTransient_Null;
+
+typedef struct
+{
+	FosterTransient_Null transientVertices;
+	FosterTransient_Null transientIndices;
+	int frameCount;
+	int64_t draws;
+	int64_t invalidDraws;
+	int64_t clears;
+	int64_t triangles;
+	FosterFrameStats stats;
+} FosterNullState;
+
+static FosterNullState fnull;
+
+int FosterTextureFormatSize_Null(FosterTextureFormat format)
+{
+	switch (format)
+	{
+		case FOSTER_TEXTURE_FORMAT_R8G8B8A8: return 4;
+		case FOSTER_TEXTURE_FORMAT_R8: return 1;
+		case FOSTER_TEXTURE_FORMAT_DEPTH24_STENCIL8: return 4;
+		case FOSTER_TEXTURE_FORMAT_R8G8: return 2;
+		case FOSTER_TEXTURE_FORMAT_R16F: return 2;
+		case FOSTER_TEXTURE_FORMAT_R16G16B16A16F: return 8;
+		case FOSTER_TEXTURE_FORMAT_R32F: return 4;
+		case FOSTER_TEXTURE_FORMAT_DEPTH16: return 2;
+		case FOSTER_TEXTURE_FORMAT_DEPTH32F: return 4;
+	}
+
+	return 0;
+}
+
+int FosterUniformComponents_Null(FosterUniformType type)
+{
+	switch (type)
+	{
+		case FOSTER_UNIFORM_TYPE_FLOAT: return 1;
+		case FOSTER_UNIFORM_TYPE_FLOAT2: return 2;
+		case FOSTER_UNIFORM_TYPE_FLOAT3: return 3;
+		case FOSTER_UNIFORM_TYPE_FLOAT4: return 4;
+		case FOSTER_UNIFORM_TYPE_MAT3X2: return 6;
+		case FOSTER_UNIFORM_TYPE_MAT4X4: return 16;
+		default: return 0;
+	}
+}
+
+int FosterUniformIsTexture_Null(FosterUniformType type)
+{
+	return type == FOSTER_UNIFORM_TYPE_TEXTURE2D || type == FOSTER_UNIFORM_TYPE_TEXTURE2D_ARRAY;
+}
+
+FosterUniformType FosterUniformTypeFromGLSL_Null(const char* type, int length)
+{
+	#define FOSTER_GLSL_TYPE(str, value) \
+		if (length == (int)SDL_strlen(str) && SDL_strncmp(type, str, length) == 0) return value;
+
+	FOSTER_GLSL_TYPE("float", FOSTER_UNIFORM_TYPE_FLOAT);
+	FOSTER_GLSL_TYPE("vec2", FOSTER_UNIFORM_TYPE_FLOAT2);
+	FOSTER_GLSL_TYPE("vec3", FOSTER_UNIFORM_TYPE_FLOAT3);
+	FOSTER_GLSL_TYPE("vec4", FOSTER_UNIFORM_TYPE_FLOAT4);
+	FOSTER_GLSL_TYPE("mat3x2", FOSTER_UNIFORM_TYPE_MAT3X2);
+	FOSTER_GLSL_TYPE("mat4", FOSTER_UNIFORM_TYPE_MAT4X4);
+	FOSTER_GLSL_TYPE("mat4x4", FOSTER_UNIFORM_TYPE_MAT4X4);
+	FOSTER_GLSL_TYPE("sampler2D", FOSTER_UNIFORM_TYPE_TEXTURE2D);
+	FOSTER_GLSL_TYPE("sampler2DArray", FOSTER_UNIFORM_TYPE_TEXTURE2D_ARRAY);
+
+	#undef FOSTER_GLSL_TYPE
+	return FOSTER_UNIFORM_TYPE_NONE;
+}
+
+// Minimal GLSL tokenizer, just enough to find uniform declarations.
+// Skips whitespace, comments and preprocessor lines.
+const char* FosterNextToken_Null(const char* src, int* length)
+{
+	while (*src != '\0')
+	{
+		if (*src == ' ' || *src == '\t' || *src == '\r' || *src == '\n')
+		{
+			src++;
+		}
+		else if (*src == '#' || (src[0] == '/' && src[1] == '/'))
+		{
+			while (*src != '\0' && *src != '\n')
+				src++;
+		}
+		else if (src[0] == '/' && src[1] == '*')
+		{
+			src += 2;
+			while (*src != '\0' && !(src[0] == '*' && src[1] == '/'))
+				src++;
+			if (*src != '\0')
+				src += 2;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	const char* end = src;
+	if (*end == '_' || SDL_isalnum(*end))
+	{
+		while (*end == '_' || SDL_isalnum(*end))
+			end++;
+	}
+	else if (*end != '\0')
+	{
+		end++;
+	}
+
+	*length = (int)(end - src);
+	return src;
+}
+
+#define FOSTER_TOKEN_IS(token, length, str) \
+	((length) == (int)SDL_strlen(str) && SDL_strncmp((token), (str), (length)) == 0)
+
+void FosterShaderAddUniform_Null(FosterShader_Null* shader, const char* name, int nameLength, FosterUniformType type, int arrayElements, int bufferIndex)
+{
+	// uniforms are usually declared in both the vertex and fragment shader
+	for (int i = 0; i < shader->uniformCount; i++)
+	{
+		if ((int)SDL_strlen(shader->uniforms[i].name) == nameLength &&
+			SDL_strncmp(shader->uniforms[i].name, name, nameLength) == 0)
+			return;
+	}
+
+	shader->uniforms = (FosterUniform_Null*)SDL_realloc(shader->uniforms, sizeof(FosterUniform_Null) * (shader->uniformCount + 1));
+
+	FosterUniform_Null* uniform = shader->uniforms + shader->uniformCount;
+	uniform->name = (char*)SDL_malloc(nameLength + 1);
+	SDL_strlcpy(uniform->name, name, nameLength + 1);
+	uniform->samplerName = NULL;
+	uniform->type = type;
+	uniform->arrayElements = arrayElements;
+	uniform->samplerIndex = 0;
+	uniform->valueIndex = 0;
+	uniform->bufferIndex = FosterUniformIsTexture_Null(type) ? -1 : bufferIndex;
+
+	// match the OpenGL renderer, which splits textures into a Texture & Sampler
+	if (FosterUniformIsTexture_Null(type))
+	{
+		uniform->samplerName = (char*)SDL_malloc(nameLength + 16);
+		SDL_snprintf(uniform->samplerName, nameLength + 16, "%s_sampler", uniform->name);
+		uniform->samplerIndex = shader->samplerCount;
+		shader->samplerCount += arrayElements;
+	}
+	else
+	{
+		uniform->valueIndex = shader->valueCount;
+		shader->valueCount += arrayElements * FosterUniformComponents_Null(type);
+	}
+
+	shader->uniformCount++;
+}
+
+// Parses "type name[N];" declarations, returning the position after them
+const char* FosterShaderParseDeclaration_Null(FosterShader_Null* shader, const char* src, const char* prefix, int prefixLength, int bufferIndex)
+{
+	int length;
+	const char* token = FosterNextToken_Null(src, &length);
+
+	// skip precision qualifiers
+	while (FOSTER_TOKEN_IS(token, length, "lowp") ||
+		FOSTER_TOKEN_IS(token, length, "mediump") ||
+		FOSTER_TOKEN_IS(token, length, "highp"))
+		token = FosterNextToken_Null(token + length, &length);
+
+	FosterUniformType type = FosterUniformTypeFromGLSL_Null(token, length);
+	src = token + length;
+
+	// there may be several comma-separated names
+	while (*src != '\0')
+	{
+		const char* name = FosterNextToken_Null(src, &length);
+		int nameLength = length;
+		int arrayElements = 1;
+		src = name + length;
+
+		token = FosterNextToken_Null(src, &length);
+		if (FOSTER_TOKEN_IS(token, length, "["))
+		{
+			token = FosterNextToken_Null(token + length, &length);
+			arrayElements = SDL_atoi(token);
+			if (arrayElements <= 0)
+				arrayElements = 1;
+			while (*token != '\0' && *token != ']')
+				token++;
+			token = FosterNextToken_Null(token, &length);
+			token = FosterNextToken_Null(token + length, &length);
+		}
+
+		if (nameLength > 0 && nameLength < FOSTER_MAX_UNIFORM_NAME)
+		{
+			char fullName[FOSTER_MAX_UNIFORM_NAME * 2];
+			SDL_snprintf(fullName, sizeof(fullName), "%.*s%.*s", prefixLength, prefix, nameLength, name);
+			FosterShaderAddUniform_Null(shader, fullName, (int)SDL_strlen(fullName), type, arrayElements, bufferIndex);
+		}
+
+		src = token + length;
+		if (!FOSTER_TOKEN_IS(token, length, ","))
+			break;
+	}
+
+	return src;
+}
+
+void FosterShaderReflect_Null(FosterShader_Null* shader, const char* src)
+{
+	int length;
+	const char* token = FosterNextToken_Null(src, &length);
+
+	while (length > 0)
+	{
+		if (!FOSTER_TOKEN_IS(token, length, "uniform"))
+		{
+			token = FosterNextToken_Null(token + length, &length);
+			continue;
+		}
+
+		const char* next = token + length;
+		const char* blockName = FosterNextToken_Null(next, &length);
+		int blockNameLength = length;
+		const char* brace = FosterNextToken_Null(blockName + length, &length);
+
+		// uniform blocks report their members as regular uniforms
+		if (FOSTER_TOKEN_IS(brace, length, "{"))
+		{
+			const char* members = brace + length;
+			const char* end = members;
+			while (*end != '\0' && *end != '}')
+				end++;
+
+			// instanced blocks prefix their members with the block name
+			int instanceLength;
+			const char* instance = FosterNextToken_Null(*end == '}' ? end + 1 : end, &instanceLength);
+			int hasInstance = instanceLength > 0 && (*instance == '_' || SDL_isalpha(*instance));
+
+			char prefix[FOSTER_MAX_UNIFORM_NAME];
+			int prefixLength = 0;
+			if (hasInstance && blockNameLength < FOSTER_MAX_UNIFORM_NAME - 1)
+				prefixLength = SDL_snprintf(prefix, sizeof(prefix), "%.*s.", blockNameLength, blockName);
+
+			int uniformCount = shader->uniformCount;
+			while (members < end)
+			{
+				int memberLength;
+				const char* member = FosterNextToken_Null(members, &memberLength);
+				if (member >= end || memberLength <= 0)
+					break;
+				members = FosterShaderParseDeclaration_Null(shader, members, prefix, prefixLength, shader->blockCount);
+			}
+
+			// blocks are usually declared in both the vertex and fragment shader
+			if (shader->uniformCount > uniformCount)
+				shader->blockCount++;
+			next = end;
+		}
+		else
+		{
+			next = FosterShaderParseDeclaration_Null(shader, next, NULL, 0, -1);
+		}
+
+		token = FosterNextToken_Null(next, &length);
+	}
+}
+
+#undef FOSTER_TOKEN_IS
+
+void FosterTextureReturnReference_Null(FosterTexture_Null* texture)
+{
+	if (texture != NULL)
+	{
+		texture->refCount--;
+		if (texture->refCount <= 0)
+		{
+			if (!texture->disposed)
+				FOSTER_LOG_ERROR("Texture is being free'd without deleting its Texture Data");
+			SDL_free(texture);
+		}
+	}
+}
+
+FosterTexture_Null* FosterTextureRequestReference_Null(FosterTexture_Null* texture)
+{
+	if (texture != NULL)
+		texture->refCount++;
+	return texture;
+}
+
+void FosterTransientCreate_Null(FosterTransient_Null* transient, int size)
+{
+	transient->data = (unsigned char*)SDL_malloc(size);
+	transient->size = size;
+	transient->offset = 0;
+	transient->overflow = 0;
+}
+
+int FosterTransientFits_Null(FosterTransient_Null* transient, int dataSize)
+{
+	int start = (transient->offset + 15) & ~15;
+
+	if (dataSize <= 0 || start + dataSize > transient->size)
+	{
+		if (dataSize > 0)
+			transient->overflow = 1;
+		return 0;
+	}
+
+	return 1;
+}
+
+void* FosterTransientAlloc_Null(FosterTransient_Null* transient, int dataSize, int* offset)
+{
+	if (!FosterTransientFits_Null(transient, dataSize))
+		return NULL;
+
+	int start = (transient->offset + 15) & ~15;
+	transient->offset = start + dataSize;
+	*offset = start;
+	return transient->data + start;
+}
+
+void FosterTransientReset_Null(FosterTransient_Null* transient)
+{
+	if (transient->overflow)
+	{
+		int size = transient->size * 2;
+		SDL_free(transient->data);
+		FosterTransientCreate_Null(transient, size);
+	}
+
+	transient->offset = 0;
+}
+
+void FosterPrepare_Null()
+{
+
+}
+
+bool FosterInitialize_Null()
+{
+	fnull.frameCount = 0;
+	fnull.draws = 0;
+	fnull.invalidDraws = 0;
+	fnull.clears = 0;
+	fnull.triangles = 0;
+	FosterTransientCreate_Null(&fnull.transientVertices, 1024 * 1024);
+	FosterTransientCreate_Null(&fnull.transientIndices, 256 * 1024);
+
+	FOSTER_LOG_INFO("Null Renderer: commands are validated but not rasterized");
+	return true;
+}
+
+void FosterShutdown_Null()
+{
+	FOSTER_LOG_INFO("Null Renderer: %i frames, %lld draws (%lld triangles, %lld invalid), %lld clears",
+		fnull.frameCount,
+		(long long)fnull.draws,
+		(long long)fnull.triangles,
+		(long long)fnull.invalidDraws,
+		(long long)fnull.clears);
+
+	SDL_free(fnull.transientVertices.data);
+	SDL_free(fnull.transientIndices.data);
+	fnull.transientVertices.data = NULL;
+	fnull.transientIndices.data = NULL;
+}
+
+void FosterFrameBegin_Null()
+{
+	FosterFrameStats zeroStats = { 0 };
+	fnull.stats = zeroStats;
+}
+
+void FosterFrameEnd_Null()
+{
+	FosterTransientReset_Null(&fnull.transientVertices);
+	FosterTransientReset_Null(&fnull.transientIndices);
+	fnull.frameCount++;
+}
+
+int FosterGetMaxTextureSize_Null()
+{
+	return FOSTER_NULL_MAX_TEXTURE_SIZE;
+}
+
+// Creates a 2D Texture, or a 2D Texture Array if layers is larger than 0
+FosterTexture_Null* FosterTextureInit_Null(int width, int height, int layers, int mipLevels, FosterTextureFormat format)
+{
+	if (width > FOSTER_NULL_MAX_TEXTURE_SIZE || height > FOSTER_NULL_MAX_TEXTURE_SIZE)
+	{
+		FOSTER_LOG_ERROR("Exceeded Max Texture Size of %i", FOSTER_NULL_MAX_TEXTURE_SIZE);
+		return NULL;
+	}
+
+	if (layers > FOSTER_NULL_MAX_TEXTURE_LAYERS)
+	{
+		FOSTER_LOG_ERROR("Exceeded Max Texture Layers of %i", FOSTER_NULL_MAX_TEXTURE_LAYERS);
+		return NULL;
+	}
+
+	if (mipLevels < 1 || mipLevels > FosterTextureMaxMipLevels(width, height))
+	{
+		FOSTER_LOG_ERROR("Invalid Texture mip level count (%i)", mipLevels);
+		return NULL;
+	}
+
+	int size = FosterTextureFormatSize_Null(format);
+	if (size <= 0)
+	{
+		FOSTER_LOG_ERROR("Invalid Texture Format (%i)", format);
+		return NULL;
+	}
+
+	FosterTexture_Null* tex = (FosterTexture_Null*)SDL_malloc(sizeof(FosterTexture_Null));
+	tex->width = width;
+	tex->height = height;
+	tex->layers = layers;
+	tex->mipLevels = mipLevels;
+	tex->format = format;
+	tex->dataSize = width * height * size * (layers > 0 ? layers : 1);
+	tex->data = (unsigned char*)SDL_calloc(1, tex->dataSize);
+	tex->refCount = 1;
+	tex->disposed = 0;
+	return tex;
+}
+
+FosterTexture* FosterTextureCreate_Null(int width, int height, int mipLevels, FosterTextureFormat format)
+{
+	return (FosterTexture*)FosterTextureInit_Null(width, height, 0, mipLevels, format);
+}
+
+FosterTexture* FosterTextureCreateArray_Null(int width, int height, int layers, int mipLevels, FosterTextureFormat format)
+{
+	if (layers <= 0)
+	{
+		FOSTER_LOG_ERROR("Texture Arrays must have at least 1 layer");
+		return NULL;
+	}
+
+	return (FosterTexture*)FosterTextureInit_Null(width, height, layers, mipLevels, format);
+}
+
+void FosterTextureSetData_Null(FosterTexture* texture, void* data, int length)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+
+	if (tex->disposed)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: Texture is disposed");
+		return;
+	}
+
+	if (length < tex->dataSize)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: %i bytes given, but the Texture is %i bytes", length, tex->dataSize);
+		return;
+	}
+
+	SDL_memcpy(tex->data, data, tex->dataSize);
+	fnull.stats.textureUploadBytes += tex->dataSize;
+}
+
+void FosterTextureSetLayerData_Null(FosterTexture* texture, int layer, void* data, int length)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+	int layerCount = tex->layers > 0 ? tex->layers : 1;
+	int layerSize = tex->dataSize / layerCount;
+
+	if (tex->disposed)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: Texture is disposed");
+		return;
+	}
+
+	if (layer < 0 || layer >= layerCount)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: layer %i is out of range", layer);
+		return;
+	}
+
+	if (length < layerSize)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: %i bytes given, but the Texture layer is %i bytes", length, layerSize);
+		return;
+	}
+
+	SDL_memcpy(tex->data + (size_t)layerSize * layer, data, layerSize);
+	fnull.stats.textureUploadBytes += layerSize;
+}
+
+void FosterTextureSetLevelData_Null(FosterTexture* texture, int level, void* data, int length)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+
+	if (tex->disposed)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: Texture is disposed");
+		return;
+	}
+
+	if (level < 0 || level >= tex->mipLevels)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: mip level %i is out of range", level);
+		return;
+	}
+
+	// only the first level is stored, but every level is validated
+	int w = tex->width >> level > 0 ? tex->width >> level : 1;
+	int h = tex->height >> level > 0 ? tex->height >> level : 1;
+	int size = w * h * (tex->layers > 0 ? tex->layers : 1) * FosterTextureFormatSize_Null(tex->format);
+	if (length < size)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: %i bytes given, but mip level %i is %i bytes", length, level, size);
+		return;
+	}
+
+	if (level == 0)
+		FosterTextureSetData_Null(texture, data, length);
+}
+
+void FosterTextureGenerateMipmaps_Null(FosterTexture* texture)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+
+	if (FosterTextureFormatIsDepth(tex->format))
+		FOSTER_LOG_ERROR("Failed to generate Texture mipmaps: depth Textures can't be filtered");
+}
+
+void FosterTextureSetDataRect_Null(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+	int pixelSize = FosterTextureFormatSize_Null(tex->format);
+
+	if (tex->disposed)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: Texture is disposed");
+		return;
+	}
+
+	if (tex->layers > 0)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: Texture Arrays can only be set a layer at a time");
+		return;
+	}
+
+	if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > tex->width || y + h > tex->height)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: rectangle [%i, %i, %i, %i] is out of bounds", x, y, w, h);
+		return;
+	}
+
+	if (stride <= 0)
+		stride = w * pixelSize;
+	if (stride < w * pixelSize || stride % pixelSize != 0)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: invalid stride %i", stride);
+		return;
+	}
+
+	for (int row = 0; row < h; row++)
+	{
+		SDL_memcpy(
+			tex->data + ((size_t)(y + row) * tex->width + x) * pixelSize,
+			(unsigned char*)data + (size_t)row * stride,
+			(size_t)w * pixelSize);
+	}
+	fnull.stats.textureUploadBytes += w * h * pixelSize;
+}
+
+void FosterSetUploadBudget_Null(int bytesPerFrame)
+{
+	// uploads are never deferred, so there's nothing to budget
+	(void)bytesPerFrame;
+}
+
+int FosterGetPendingUploadSize_Null()
+{
+	return 0;
+}
+
+void FosterGetFrameStats_Null(FosterFrameStats* stats)
+{
+	// nothing is bound or switched, so only draws, clears and uploads are counted
+	*stats = fnull.stats;
+}
+
+void FosterTextureGetData_Null(FosterTexture* texture, void* data, int length)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+
+	if (tex->disposed)
+	{
+		FOSTER_LOG_ERROR("Failed to get Texture data: Texture is disposed");
+		return;
+	}
+
+	SDL_memcpy(data, tex->data, length < tex->dataSize ? length : tex->dataSize);
+}
+
+FosterReadback* FosterTextureGetDataAsync_Null(FosterTexture* texture)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+	FosterReadback_Null* readback = (FosterReadback_Null*)SDL_malloc(sizeof(FosterReadback_Null));
+
+	// there's no GPU to wait on, so the data is copied immediately
+	readback->size = tex->dataSize;
+	readback->data = (unsigned char*)SDL_malloc(tex->dataSize);
+	FosterTextureGetData_Null(texture, readback->data, readback->size);
+
+	return (FosterReadback*)readback;
+}
+
+FosterBool FosterReadbackIsReady_Null(FosterReadback* readback)
+{
+	(void)readback;
+	return 1;
+}
+
+void FosterReadbackGetData_Null(FosterReadback* readback, void* data, int length)
+{
+	FosterReadback_Null* it = (FosterReadback_Null*)readback;
+	SDL_memcpy(data, it->data, length < it->size ? length : it->size);
+}
+
+void FosterReadbackDestroy_Null(FosterReadback* readback)
+{
+	FosterReadback_Null* it = (FosterReadback_Null*)readback;
+	SDL_free(it->data);
+	SDL_free(it);
+}
+
+void FosterTextureDestroy_Null(FosterTexture* texture)
+{
+	FosterTexture_Null* tex = (FosterTexture_Null*)texture;
+
+	if (!tex->disposed)
+	{
+		tex->disposed = 1;
+		SDL_free(tex->data);
+		tex->data = NULL;
+		FosterTextureReturnReference_Null(tex);
+	}
+}
+
+FosterTarget* FosterTargetCreate_Null(int width, int height, int samples, FosterTextureFormat* attachments, int attachmentCount)
+{
+	FosterTarget_Null* tar = (FosterTarget_Null*)SDL_malloc(sizeof(FosterTarget_Null));
+	tar->width = width;
+	tar->height = height;
+	tar->samples = samples > 1 ? samples : 1;
+	tar->attachmentCount = attachmentCount;
+	for (int i = 0; i < FOSTER_MAX_TARGET_ATTACHMENTS; i++)
+		tar->attachments[i] = NULL;
+
+	for (int i = 0; i < attachmentCount && i < FOSTER_MAX_TARGET_ATTACHMENTS; i++)
+	{
+		tar->attachments[i] = (FosterTexture_Null*)FosterTextureCreate_Null(width, height, 1, attachments[i]);
+
+		if (tar->attachments[i] == NULL)
+		{
+			for (int j = 0; j < i; j++)
+				FosterTextureDestroy_Null((FosterTexture*)tar->attachments[j]);
+			SDL_free(tar);
+			FOSTER_LOG_ERROR("Failed to create Target Attachment");
+			return NULL;
+		}
+	}
+
+	return (FosterTarget*)tar;
+}
+
+FosterTexture* FosterTargetGetAttachment_Null(FosterTarget* target, int index)
+{
+	FosterTarget_Null* tar = (FosterTarget_Null*)target;
+	return (FosterTexture*)tar->attachments[index];
+}
+
+void FosterTargetResolve_Null(FosterTarget* target)
+{
+	// nothing is drawn, so there are no samples to resolve
+	(void)target;
+}
+
+void FosterTargetDestroy_Null(FosterTarget* target)
+{
+	FosterTarget_Null* tar = (FosterTarget_Null*)target;
+
+	for (int i = 0; i < FOSTER_MAX_TARGET_ATTACHMENTS; i++)
+	{
+		if (tar->attachments[i] != NULL)
+			FosterTextureDestroy_Null((FosterTexture*)tar->attachments[i]);
+	}
+
+	SDL_free(tar);
+}
+
+FosterShader* FosterShaderCreate_Null(FosterShaderData* data)
+{
+	if (data->vertexShader == NULL)
+	{
+		FOSTER_LOG_ERROR("Invalid Vertex Shader");
+		return NULL;
+	}
+
+	if (data->fragmentShader == NULL)
+	{
+		FOSTER_LOG_ERROR("Invalid Fragment Shader");
+		return NULL;
+	}
+
+	FosterShader_Null* shader = (FosterShader_Null*)SDL_malloc(sizeof(FosterShader_Null));
+	shader->uniformCount = 0;
+	shader->samplerCount = 0;
+	shader->valueCount = 0;
+	shader->blockCount = 0;
+	shader->uniforms = NULL;
+	shader->values = NULL;
+
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+	{
+		shader->textures[i] = NULL;
+		shader->samplers[i].filter = FOSTER_TEXTURE_FILTER_LINEAR;
+		shader->samplers[i].wrapX = FOSTER_TEXTURE_WRAP_CLAMP_TO_EDGE;
+		shader->samplers[i].wrapY = FOSTER_TEXTURE_WRAP_CLAMP_TO_EDGE;
+		shader->samplers[i].anisotropy = 0;
+	}
+
+	// there's no shader compiler, but Materials need to know what uniforms exist
+	char* vertex = FosterShaderApplyDefines((const char*)data->vertexShader, data->defines);
+	char* fragment = FosterShaderApplyDefines((const char*)data->fragmentShader, data->defines);
+	FosterShaderReflect_Null(shader, vertex);
+	FosterShaderReflect_Null(shader, fragment);
+	SDL_free(vertex);
+	SDL_free(fragment);
+
+	if (shader->valueCount > 0)
+		shader->values = (float*)SDL_calloc(shader->valueCount, sizeof(float));
+
+	return (FosterShader*)shader;
+}
+
+FosterShader* FosterShaderCreateAsync_Null(FosterShaderData* data)
+{
+	// there's nothing to compile, so it's ready immediately
+	return FosterShaderCreate_Null(data);
+}
+
+FosterBool FosterShaderIsReady_Null(FosterShader* shader)
+{
+	(void)shader;
+	return 1;
+}
+
+void FosterShaderGetUniforms_Null(FosterShader* shader, FosterUniformInfo* output, int* count, int max)
+{
+	FosterShader_Null* it = (FosterShader_Null*)shader;
+
+	int t = 0;
+
+	for (int i = 0; t < max && i < it->uniformCount; i++)
+	{
+		FosterUniform_Null* uniform = it->uniforms + i;
+
+		output[t].index = i;
+		output[t].name = uniform->name;
+		output[t].type = uniform->type;
+		output[t].arrayElements = uniform->arrayElements;
+		output[t].bufferIndex = uniform->bufferIndex;
+		t++;
+
+		if (FosterUniformIsTexture_Null(uniform->type) && t < max)
+		{
+			output[t].index = i;
+			output[t].name = uniform->samplerName;
+			output[t].type = FOSTER_UNIFORM_TYPE_SAMPLER2D;
+			output[t].arrayElements = uniform->arrayElements;
+			output[t].bufferIndex = -1;
+			t++;
+		}
+	}
+
+	*count = t;
+}
+
+void FosterShaderSetUniform_Null(FosterShader* shader, int index, float* values)
+{
+	FosterShader_Null* it = (FosterShader_Null*)shader;
+
+	if (index < 0 || index >= it->uniformCount)
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%i': index out of bounds", index);
+		return;
+	}
+
+	FosterUniform_Null* uniform = it->uniforms + index;
+	int components = FosterUniformComponents_Null(uniform->type);
+	if (components <= 0)
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%s', unsupported type '%i'", uniform->name, uniform->type);
+		return;
+	}
+
+	SDL_memcpy(it->values + uniform->valueIndex, values, sizeof(float) * components * uniform->arrayElements);
+}
+
+void FosterShaderSetTexture_Null(FosterShader* shader, int index, FosterTexture** values)
+{
+	FosterShader_Null* it = (FosterShader_Null*)shader;
+
+	if (index < 0 || index >= it->uniformCount)
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%i': index out of bounds", index);
+		return;
+	}
+
+	FosterUniform_Null* uniform = it->uniforms + index;
+	if (!FosterUniformIsTexture_Null(uniform->type))
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%s': not a Texture", uniform->name);
+		return;
+	}
+
+	for (int i = 0; i < uniform->arrayElements && uniform->samplerIndex + i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+	{
+		int n = uniform->samplerIndex + i;
+		if (it->textures[n] == (FosterTexture_Null*)values[i])
+			continue;
+		FosterTextureReturnReference_Null(it->textures[n]);
+		it->textures[n] = FosterTextureRequestReference_Null((FosterTexture_Null*)values[i]);
+	}
+}
+
+void FosterShaderSetSampler_Null(FosterShader* shader, int index, FosterTextureSampler* values)
+{
+	FosterShader_Null* it = (FosterShader_Null*)shader;
+
+	if (index < 0 || index >= it->uniformCount)
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%i': index out of bounds", index);
+		return;
+	}
+
+	FosterUniform_Null* uniform = it->uniforms + index;
+	if (!FosterUniformIsTexture_Null(uniform->type))
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%s': not a Sampler", uniform->name);
+		return;
+	}
+
+	for (int i = 0; i < uniform->arrayElements && uniform->samplerIndex + i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+		it->samplers[uniform->samplerIndex + i] = values[i];
+}
+
+void FosterShaderDestroy_Null(FosterShader* shader)
+{
+	FosterShader_Null* it = (FosterShader_Null*)shader;
+
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+		FosterTextureReturnReference_Null(it->textures[i]);
+
+	for (int i = 0; i < it->uniformCount; i++)
+	{
+		SDL_free(it->uniforms[i].name);
+		SDL_free(it->uniforms[i].samplerName);
+	}
+
+	SDL_free(it->uniforms);
+	SDL_free(it->values);
+	SDL_free(it);
+}
+
+FosterPipeline* FosterPipelineCreate_Null(FosterPipelineDesc* desc)
+{
+	FosterPipeline_Null* pipeline = (FosterPipeline_Null*)SDL_malloc(sizeof(FosterPipeline_Null));
+	pipeline->desc = *desc;
+	return (FosterPipeline*)pipeline;
+}
+
+void FosterPipelineDestroy_Null(FosterPipeline* pipeline)
+{
+	SDL_free(pipeline);
+}
+
+FosterMesh* FosterMeshCreate_Null(FosterMeshUsage usage)
+{
+	FosterMesh_Null* mesh = (FosterMesh_Null*)SDL_malloc(sizeof(FosterMesh_Null));
+	mesh->vertexData = NULL;
+	mesh->vertexDataSize = 0;
+	mesh->indexData = NULL;
+	mesh->indexDataSize = 0;
+	mesh->indexSize = 2;
+	mesh->instanceData = NULL;
+	mesh->instanceDataSize = 0;
+	mesh->vertexStride = 0;
+	mesh->instanceStride = 0;
+	mesh->usage = usage;
+	return (FosterMesh*)mesh;
+}
+
+void FosterMeshSetVertexFormat_Null(FosterMesh* mesh, FosterVertexFormat* format)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+	it->vertexStride = format->stride;
+}
+
+void FosterMeshSetVertexData_Null(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+
+	int totalSize = dataDestOffset + dataSize;
+	if (totalSize > it->vertexDataSize)
+	{
+		it->vertexData = (unsigned char*)SDL_realloc(it->vertexData, totalSize);
+		it->vertexDataSize = totalSize;
+	}
+
+	if (data != NULL)
+	{
+		SDL_memcpy(it->vertexData + dataDestOffset, data, dataSize);
+		fnull.stats.bufferUploadBytes += dataSize;
+	}
+}
+
+void FosterMeshSetIndexFormat_Null(FosterMesh* mesh, FosterIndexFormat format)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+
+	switch (format)
+	{
+		case FOSTER_INDEX_FORMAT_SIXTEEN:
+			it->indexSize = 2;
+			break;
+		case FOSTER_INDEX_FORMAT_THIRTY_TWO:
+			it->indexSize = 4;
+			break;
+		default:
+			FOSTER_LOG_ERROR("Invalid Index Format '%i'", format);
+			break;
+	}
+}
+
+void FosterMeshSetIndexData_Null(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+
+	int totalSize = dataDestOffset + dataSize;
+	if (totalSize > it->indexDataSize)
+	{
+		it->indexData = (unsigned char*)SDL_realloc(it->indexData, totalSize);
+		it->indexDataSize = totalSize;
+	}
+
+	if (data != NULL)
+	{
+		SDL_memcpy(it->indexData + dataDestOffset, data, dataSize);
+		fnull.stats.bufferUploadBytes += dataSize;
+	}
+}
+
+void FosterMeshSetInstanceFormat_Null(FosterMesh* mesh, FosterVertexFormat* format)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+	it->instanceStride = format->stride;
+}
+
+void FosterMeshSetInstanceData_Null(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+
+	int totalSize = dataDestOffset + dataSize;
+	if (totalSize > it->instanceDataSize)
+	{
+		it->instanceData = (unsigned char*)SDL_realloc(it->instanceData, totalSize);
+		it->instanceDataSize = totalSize;
+	}
+
+	if (data != NULL)
+	{
+		SDL_memcpy(it->instanceData + dataDestOffset, data, dataSize);
+		fnull.stats.bufferUploadBytes += dataSize;
+	}
+}
+
+void FosterMeshDestroy_Null(FosterMesh* mesh)
+{
+	FosterMesh_Null* it = (FosterMesh_Null*)mesh;
+	SDL_free(it->vertexData);
+	SDL_free(it->indexData);
+	SDL_free(it->instanceData);
+	SDL_free(it);
+}
+
+void* FosterTransientAllocVertices_Null(int dataSize, int* offset)
+{
+	void* result = FosterTransientAlloc_Null(&fnull.transientVertices, dataSize, offset);
+	if (result != NULL)
+		fnull.stats.bufferUploadBytes += dataSize;
+	return result;
+}
+
+void* FosterTransientAllocIndices_Null(int dataSize, int* offset)
+{
+	void* result = FosterTransientAlloc_Null(&fnull.transientIndices, dataSize, offset);
+	if (result != NULL)
+		fnull.stats.bufferUploadBytes += dataSize;
+	return result;
+}
+
+FosterBool FosterTransientAllocGeometry_Null(int vertexSize, int indexSize, void** vertices, void** indices, int* vertexOffset, int* indexOffset)
+{
+	int vertexFits = FosterTransientFits_Null(&fnull.transientVertices, vertexSize);
+	int indexFits = FosterTransientFits_Null(&fnull.transientIndices, indexSize);
+	if (!vertexFits || !indexFits)
+		return 0;
+
+	*vertices = FosterTransientAllocVertices_Null(vertexSize, vertexOffset);
+	*indices = FosterTransientAllocIndices_Null(indexSize, indexOffset);
+	return 1;
+}
+
+void FosterShaderApplyUniforms_Null(FosterShader* shaderPtr, float* values, FosterTextureSampler* samplers, FosterTexture** textures)
+{
+	FosterShader_Null* shader = (FosterShader_Null*)shaderPtr;
+
+	for (int i = 0; i < shader->uniformCount; i++)
+	{
+		FosterUniform_Null* uniform = shader->uniforms + i;
+
+		if (FosterUniformIsTexture_Null(uniform->type))
+		{
+			if (textures != NULL)
+				FosterShaderSetTexture_Null((FosterShader*)shader, i, textures + uniform->samplerIndex);
+			if (samplers != NULL)
+				FosterShaderSetSampler_Null((FosterShader*)shader, i, samplers + uniform->samplerIndex);
+		}
+		else if (values != NULL && FosterUniformComponents_Null(uniform->type) > 0)
+		{
+			FosterShaderSetUniform_Null((FosterShader*)shader, i, values + uniform->valueIndex);
+		}
+	}
+}
+
+void FosterDraw_Null(FosterDrawCommand* command)
+{
+	FosterTarget_Null* target = (FosterTarget_Null*)command->target;
+	FosterShader_Null* shader = (FosterShader_Null*)command->shader;
+	FosterMesh_Null* mesh = (FosterMesh_Null*)command->mesh;
+	fnull.stats.drawCommands++;
+
+	if (shader == NULL || mesh == NULL)
+	{
+		FOSTER_LOG_ERROR("Invalid Draw: missing %s", shader == NULL ? "Shader" : "Mesh");
+		fnull.invalidDraws++;
+		return;
+	}
+
+	if (command->uniformValues != NULL || command->uniformSamplers != NULL || command->uniformTextures != NULL)
+		FosterShaderApplyUniforms_Null((FosterShader*)shader, command->uniformValues, command->uniformSamplers, command->uniformTextures);
+
+	// transient data has to have been allocated this frame
+	int64_t indexDataStart = 0;
+	int64_t indexDataEnd = mesh->indexDataSize;
+	if (command->transient)
+	{
+		indexDataStart = command->transientIndexOffset;
+		indexDataEnd = fnull.transientIndices.offset;
+
+		if (command->transientVertexOffset < 0 || command->transientVertexOffset >= fnull.transientVertices.offset ||
+			command->transientIndexOffset < 0 || command->transientIndexOffset >= fnull.transientIndices.offset)
+		{
+			FOSTER_LOG_ERROR("Invalid Draw: transient data [%i, %i] was not allocated this frame",
+				command->transientVertexOffset, command->transientIndexOffset);
+			fnull.invalidDraws++;
+			return;
+		}
+	}
+
+	// either a single range of indices, or a list of them drawn with the same state
+	FosterDrawRange single = { command->indexStart, command->indexCount, command->baseVertex };
+	FosterDrawRange* ranges = &single;
+	int rangeCount = 1;
+	int64_t indexCount = 0;
+	if (command->rangeCount > 0)
+	{
+		if (command->ranges == NULL)
+		{
+			FOSTER_LOG_ERROR("Invalid Draw: %i ranges without any data", command->rangeCount);
+			fnull.invalidDraws++;
+			return;
+		}
+		ranges = command->ranges;
+		rangeCount = command->rangeCount;
+	}
+
+	for (int i = 0; i < rangeCount; i++)
+	{
+		if (ranges[i].indexStart < 0 || ranges[i].indexCount < 0 ||
+			indexDataStart + (int64_t)(ranges[i].indexStart + ranges[i].indexCount) * mesh->indexSize > indexDataEnd)
+		{
+			FOSTER_LOG_ERROR("Invalid Draw: indices [%i, %i] are out of range of the Mesh",
+				ranges[i].indexStart, ranges[i].indexStart + ranges[i].indexCount);
+			fnull.invalidDraws++;
+			return;
+		}
+		indexCount += ranges[i].indexCount;
+	}
+
+	if (command->instanceCount > 0 && mesh->instanceStride > 0 && (command->instanceStart < 0 ||
+		(int64_t)(command->instanceStart + command->instanceCount) * mesh->instanceStride > mesh->instanceDataSize))
+	{
+		FOSTER_LOG_ERROR("Invalid Draw: instances [%i, %i] are out of range of the Mesh",
+			command->instanceStart, command->instanceStart + command->instanceCount);
+		fnull.invalidDraws++;
+		return;
+	}
+
+	for (int i = 0; i < shader->samplerCount && i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+	{
+		if (shader->textures[i] != NULL && shader->textures[i]->disposed)
+		{
+			FOSTER_LOG_ERROR("Invalid Draw: Texture %i is disposed", i);
+			fnull.invalidDraws++;
+			return;
+		}
+	}
+
+	if (target != NULL)
+	{
+		for (int i = 0; i < target->attachmentCount; i++)
+		{
+			if (target->attachments[i]->disposed)
+			{
+				FOSTER_LOG_ERROR("Invalid Draw: Target is disposed");
+				fnull.invalidDraws++;
+				return;
+			}
+		}
+	}
+
+	fnull.draws++;
+	fnull.triangles += (indexCount / 3) * (command->instanceCount > 0 ? command->instanceCount : 1);
+	fnull.stats.drawCalls++;
+	fnull.stats.triangles += (indexCount / 3) * (command->instanceCount > 0 ? command->instanceCount : 1);
+}
+
+void FosterClear_Null(FosterClearCommand* command)
+{
+	if (command->mask != FOSTER_CLEAR_MASK_NONE)
+	{
+		fnull.clears++;
+		fnull.stats.clears++;
+	}
+}
+
+void FosterSubmitCommands_Null(FosterCommand* commands, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		switch (commands[i].type)
+		{
+			case FOSTER_COMMAND_TYPE_DRAW:
+				FosterDraw_Null(&commands[i].draw);
+				break;
+			case FOSTER_COMMAND_TYPE_CLEAR:
+				FosterClear_Null(&commands[i].clear);
+				break;
+			default:
+				FOSTER_LOG_ERROR("Invalid Command Type (%i)", commands[i].type);
+				break;
+		}
+	}
+}
+
+bool FosterGetDevice_Null(FosterRenderDevice* device)
+{
+	device->renderer = FOSTER_RENDERER_NULL;
+	device->prepare = FosterPrepare_Null;
+	device->initialize = FosterInitialize_Null;
+	device->shutdown = FosterShutdown_Null;
+	device->frameBegin = FosterFrameBegin_Null;
+	device->frameEnd = FosterFrameEnd_Null;
+	device->getMaxTextureSize = FosterGetMaxTextureSize_Null;
+	device->textureCreate = FosterTextureCreate_Null;
+	device->textureCreateArray = FosterTextureCreateArray_Null;
+	device->textureSetData = FosterTextureSetData_Null;
+	device->textureSetLayerData = FosterTextureSetLayerData_Null;
+	device->textureSetLevelData = FosterTextureSetLevelData_Null;
+	device->textureGenerateMipmaps = FosterTextureGenerateMipmaps_Null;
+	device->textureSetDataRect = FosterTextureSetDataRect_Null;
+	device->textureSetDataAsync = FosterTextureSetDataRect_Null;
+	device->setUploadBudget = FosterSetUploadBudget_Null;
+	device->getPendingUploadSize = FosterGetPendingUploadSize_Null;
+	device->getFrameStats = FosterGetFrameStats_Null;
+	device->textureGetData = FosterTextureGetData_Null;
+	device->textureGetDataAsync = FosterTextureGetDataAsync_Null;
+	device->readbackIsReady = FosterReadbackIsReady_Null;
+	device->readbackGetData = FosterReadbackGetData_Null;
+	device->readbackDestroy = FosterReadbackDestroy_Null;
+	device->textureDestroy = FosterTextureDestroy_Null;
+	device->targetCreate = FosterTargetCreate_Null;
+	device->targetGetAttachment = FosterTargetGetAttachment_Null;
+	device->targetResolve = FosterTargetResolve_Null;
+	device->targetDestroy = FosterTargetDestroy_Null;
+	device->shaderCreate = FosterShaderCreate_Null;
+	device->shaderCreateAsync = FosterShaderCreateAsync_Null;
+	device->shaderIsReady = FosterShaderIsReady_Null;
+	device->shaderSetUniform = FosterShaderSetUniform_Null;
+	device->shaderSetTexture = FosterShaderSetTexture_Null;
+	device->shaderSetSampler = FosterShaderSetSampler_Null;
+	device->shaderApplyUniforms = FosterShaderApplyUniforms_Null;
+	device->shaderGetUniforms = FosterShaderGetUniforms_Null;
+	device->shaderDestroy = FosterShaderDestroy_Null;
+	device->pipelineCreate = FosterPipelineCreate_Null;
+	device->pipelineDestroy = FosterPipelineDestroy_Null;
+	device->meshCreate = FosterMeshCreate_Null;
+	device->meshSetVertexFormat = FosterMeshSetVertexFormat_Null;
+	device->meshSetVertexData = FosterMeshSetVertexData_Null;
+	device->meshSetIndexFormat = FosterMeshSetIndexFormat_Null;
+	device->meshSetIndexData = FosterMeshSetIndexData_Null;
+	device->meshSetInstanceFormat = FosterMeshSetInstanceFormat_Null;
+	device->meshSetInstanceData = FosterMeshSetInstanceData_Null;
+	device->meshDestroy = FosterMeshDestroy_Null;
+	device->transientAllocVertices = FosterTransientAllocVertices_Null;
+	device->transientAllocIndices = FosterTransientAllocIndices_Null;
+	device->transientAllocGeometry = FosterTransientAllocGeometry_Null;
+	device->draw = FosterDraw_Null;
+	device->clear = FosterClear_Null;
+	device->submit = FosterSubmitCommands_Null;
+	return true;
+}
@@ -32,6 +32,8 @@ typedef float            GLclampf;    /* single precision float in [0,1] */
 typedef double           GLdouble;    /* double precision float */
 typedef double           GLclampd;    /* double precision float in [0,1] */
 typedef char             GLchar;
+typedef uint64_t         GLuint64;
+typedef struct __GLsync* GLsync;
 
 // OpenGL Constants
 #define GL_DONT_CARE 0x1100
@@ -72,6 +74,7 @@ typedef char             GLchar;
 #define GL_POLYGON_OFFSET_FILL 0x8037
 #define GL_TEXTURE_2D 0x0DE1
 #define GL_TEXTURE_3D 0x806F
+#define GL_TEXTURE_2D_ARRAY 0x8C1A
 #define GL_TEXTURE_CUBE_MAP 0x8513
 #define GL_TEXTURE_CUBE_MAP_POSITIVE_X 0x8515
 #define GL_BLEND 0x0BE2
@@ -124,6 +127,9 @@ typedef char             GLchar;
 #define GL_COLOR_ATTACHMENT0 0x8CE0
 #define GL_DEPTH_ATTACHMENT 0x8D00
 #define GL_STENCIL_ATTACHMENT 0x8D20
+#define GL_COLOR 0x1800
+#define GL_DEPTH 0x1801
+#define GL_STENCIL 0x1802
 #define GL_DEPTH_STENCIL_ATTACHMENT 0x821A
 #define GL_RED 0x1903
 #define GL_RGB 0x1907
@@ -131,6 +137,7 @@ typedef char             GLchar;
 #define GL_LUMINANCE 0x1909
 #define GL_RGB8 0x8051
 #define GL_RGBA8 0x8058
+#define GL_R8 0x8229
 #define GL_RGBA4 0x8056
 #define GL_RGB5_A1 0x8057
 #define GL_RGB10_A2_EXT 0x8059
@@ -148,6 +155,7 @@ typedef char             GLchar;
 #define GL_RGBA32F 0x8814
 #define GL_RGBA16F 0x881A
 #define GL_DEPTH24_STENCIL8 0x88F0
+#define GL_DEPTH_COMPONENT32F 0x8CAC
 #define GL_COMPRESSED_TEXTURE_FORMATS 0x86A3
 #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
 #define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
@@ -160,17 +168,20 @@ typedef char             GLchar;
 #define GL_TEXTURE_MAG_FILTER 0x2800
 #define GL_TEXTURE_MIN_FILTER 0x2801
 #define GL_TEXTURE_MAX_ANISOTROPY_EXT 0x84FE
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT 0x84FF
 #define GL_TEXTURE_BASE_LEVEL 0x813C
 #define GL_TEXTURE_MAX_LEVEL 0x813D
 #define GL_TEXTURE_LOD_BIAS 0x8501
 #define GL_PACK_ALIGNMENT 0x0D05
 #define GL_UNPACK_ALIGNMENT 0x0CF5
+#define GL_UNPACK_ROW_LENGTH 0x0CF2
 #define GL_TEXTURE0 0x84C0
 #define GL_MAX_TEXTURE_IMAGE_UNITS 0x8872
 #define GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS 0x8B4C
 #define GL_ARRAY_BUFFER 0x8892
 #define GL_ELEMENT_ARRAY_BUFFER 0x8893
 #define GL_STREAM_DRAW 0x88E0
+#define GL_STREAM_READ 0x88E1
 #define GL_STATIC_DRAW 0x88E4
 #define GL_DYNAMIC_DRAW 0x88E8
 #define GL_MAX_VERTEX_ATTRIBS 0x8869
@@ -198,6 +209,7 @@ typedef char             GLchar;
 #define GL_FLOAT_VEC3 0x8B51
 #define GL_FLOAT_VEC4 0x8B52
 #define GL_SAMPLER_2D 0x8B5E
+#define GL_SAMPLER_2D_ARRAY 0x8DC1
 #define GL_FLOAT_MAT3x2 0x8B67
 #define GL_FLOAT_MAT4 0x8B5C
 #define GL_NUM_EXTENSIONS 0x821D
@@ -224,6 +236,33 @@ typedef char             GLchar;
 #define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
 #define GL_COMPILE_STATUS 0x8B81
 #define GL_LINK_STATUS 0x8B82
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#define GL_UNIFORM_BUFFER 0x8A11
+#define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0x8A34
+#define GL_ACTIVE_UNIFORM_BLOCKS 0x8A36
+#define GL_UNIFORM_BLOCK_INDEX 0x8A3A
+#define GL_UNIFORM_OFFSET 0x8A3B
+#define GL_UNIFORM_ARRAY_STRIDE 0x8A3C
+#define GL_UNIFORM_MATRIX_STRIDE 0x8A3D
+#define GL_UNIFORM_BLOCK_DATA_SIZE 0x8A40
+#define GL_MAP_READ_BIT 0x0001
+#define GL_MAP_WRITE_BIT 0x0002
+#define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+#define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_COPY_READ_BUFFER 0x8F36
+#define GL_COPY_WRITE_BUFFER 0x8F37
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+#define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x0001
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_WAIT_FAILED 0x911D
 
 // OpenGL Functions
 #define GL_FUNCTIONS \
@@ -256,13 +295,30 @@ typedef char             GLchar;
 	GL_FUNC(BindRenderbuffer, void, GLenum target, GLuint id) \
 	GL_FUNC(BindFramebuffer, void, GLenum target, GLuint id) \
 	GL_FUNC(TexImage2D, void, GLenum target, GLint level, GLenum internalFormat, GLint width, GLint height, GLint border, GLenum format, GLenum type, const void* data) \
+	GL_FUNC(TexImage3D, void, GLenum target, GLint level, GLenum internalFormat, GLint width, GLint height, GLint depth, GLint border, GLenum format, GLenum type, const void* data) \
+	GL_FUNC(TexSubImage2D, void, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint width, GLint height, GLenum format, GLenum type, const void* data) \
+	GL_FUNC(TexStorage2D, void, GLenum target, GLint levels, GLenum internalformat, GLint width, GLint height) \
+	GL_FUNC(TexStorage3D, void, GLenum target, GLint levels, GLenum internalformat, GLint width, GLint height, GLint depth) \
+	GL_FUNC(TexSubImage3D, void, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint width, GLint height, GLint depth, GLenum format, GLenum type, const void* data) \
 	GL_FUNC(FramebufferRenderbuffer, void, GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) \
 	GL_FUNC(FramebufferTexture2D, void, GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) \
 	GL_FUNC(TexParameteri, void, GLenum target, GLenum name, GLint param) \
+	GL_FUNC(GenerateMipmap, void, GLenum target) \
+	GL_FUNC(GenSamplers, void, GLsizei n, GLuint* samplers) \
+	GL_FUNC(DeleteSamplers, void, GLsizei n, const GLuint* samplers) \
+	GL_FUNC(BindSampler, void, GLuint unit, GLuint sampler) \
+	GL_FUNC(SamplerParameteri, void, GLuint sampler, GLenum name, GLint param) \
 	GL_FUNC(RenderbufferStorage, void, GLenum target, GLenum internalformat, GLint width, GLint height) \
+	GL_FUNC(RenderbufferStorageMultisample, void, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) \
+	GL_FUNC(BlitFramebuffer, void, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) \
+	GL_FUNC(ReadBuffer, void, GLenum src) \
+	GL_FUNC(InvalidateFramebuffer, void, GLenum target, GLsizei numAttachments, const GLenum* attachments) \
 	GL_FUNC(GetTexImage, void, GLenum target, GLint level, GLenum format, GLenum type, void* data) \
 	GL_FUNC(DrawElements, void, GLenum mode, GLint count, GLenum type, void* indices) \
 	GL_FUNC(DrawElementsInstanced, void, GLenum mode, GLint count, GLenum type, void* indices, GLint amount) \
+	GL_FUNC(DrawElementsBaseVertex, void, GLenum mode, GLint count, GLenum type, void* indices, GLint basevertex) \
+	GL_FUNC(DrawElementsInstancedBaseVertex, void, GLenum mode, GLint count, GLenum type, void* indices, GLint amount, GLint basevertex) \
+	GL_FUNC(MultiDrawElementsBaseVertex, void, GLenum mode, const GLint* count, GLenum type, void* const* indices, GLint drawcount, const GLint* basevertex) \
 	GL_FUNC(DrawBuffers, void, GLsizei n, const GLenum* bufs) \
 	GL_FUNC(DeleteTextures, void, GLint n, GLuint* textures) \
 	GL_FUNC(DeleteRenderbuffers, void, GLint n, GLuint* renderbuffers) \
@@ -273,7 +329,15 @@ typedef char             GLchar;
 	GL_FUNC(BindBuffer, void, GLenum target, GLuint buffer) \
 	GL_FUNC(BufferData, void, GLenum target, GLsizeiptr size, const void* data, GLenum usage) \
 	GL_FUNC(BufferSubData, void, GLenum target, GLintptr offset, GLsizeiptr size, const void* data) \
+	GL_FUNC(BufferStorage, void, GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) \
+	GL_FUNC(CopyBufferSubData, void, GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) \
 	GL_FUNC(DeleteBuffers, void, GLint n, GLuint* buffers) \
+	GL_FUNC(BindBufferRange, void, GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) \
+	GL_FUNC(MapBufferRange, void*, GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) \
+	GL_FUNC(UnmapBuffer, GLboolean, GLenum target) \
+	GL_FUNC(FenceSync, GLsync, GLenum condition, GLbitfield flags) \
+	GL_FUNC(ClientWaitSync, GLenum, GLsync sync, GLbitfield flags, GLuint64 timeout) \
+	GL_FUNC(DeleteSync, void, GLsync sync) \
 	GL_FUNC(DeleteVertexArrays, void, GLint n, GLuint* arrays) \
 	GL_FUNC(EnableVertexAttribArray, void, GLuint location) \
 	GL_FUNC(DisableVertexAttribArray, void, GLuint location) \
@@ -292,8 +356,15 @@ typedef char             GLchar;
 	GL_FUNC(LinkProgram, void, GLuint program) \
 	GL_FUNC(GetProgramiv, void, GLuint program, GLenum pname, GLint* result) \
 	GL_FUNC(GetProgramInfoLog, void, GLuint program, GLint maxLength, GLsizei* length, GLchar* infoLog) \
+	GL_FUNC(GetProgramBinary, void, GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary) \
+	GL_FUNC(ProgramBinary, void, GLuint program, GLenum binaryFormat, const void* binary, GLsizei length) \
+	GL_FUNC(ProgramParameteri, void, GLuint program, GLenum pname, GLint value) \
+	GL_FUNC(MaxShaderCompilerThreadsKHR, void, GLuint count) \
 	GL_FUNC(GetActiveUniform, void, GLuint program, GLuint index, GLint bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) \
 	GL_FUNC(GetActiveAttrib, void, GLuint program, GLuint index, GLint bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) \
+	GL_FUNC(GetActiveUniformsiv, void, GLuint program, GLsizei count, const GLuint* indices, GLenum pname, GLint* params) \
+	GL_FUNC(GetActiveUniformBlockiv, void, GLuint program, GLuint index, GLenum pname, GLint* params) \
+	GL_FUNC(UniformBlockBinding, void, GLuint program, GLuint index, GLuint binding) \
 	GL_FUNC(UseProgram, void, GLuint program) \
 	GL_FUNC(GetUniformLocation, GLint, GLuint program, const GLchar* name) \
 	GL_FUNC(GetAttribLocation, GLint, GLuint program, const GLchar* name) \
@@ -346,19 +417,35 @@ typedef void (APIENTRY* DEBUGPROC)(GLenum source,
 GL_FUNCTIONS
 #undef GL_FUNC
 
+#define FOSTER_TRANSIENT_FRAMES 3
+#define FOSTER_UPLOAD_SEGMENT_SIZE (1024 * 1024)
+#define FOSTER_UPLOAD_MAX_SEGMENT_SIZE (16 * 1024 * 1024)
+#define FOSTER_PROGRAM_BINARY_MAGIC 0x42505346 // "FSPB"
+#define FOSTER_PROGRAM_HASH_SEED 0xcbf29ce484222325ULL
 #define FOSTER_RECT_EQUAL(a, b) ((a).x == (b).x && (a).y == (b).y && (a).w == (b).w && (a).h == (b).h)
 
+// header written in front of cached program binaries
+typedef struct FosterProgramBinaryHeader_OpenGL
+{
+	Uint32 magic;
+	GLenum format;
+	Uint64 key;
+} FosterProgramBinaryHeader_OpenGL;
+
 typedef struct FosterTexture_OpenGL
 {
 	GLuint id;
 	int width;
 	int height;
+	int layers;
+	int mipLevels;
+	int pixelSize;
 	FosterTextureFormat format;
+	GLenum glTarget;
 	GLenum glInternalFormat;
 	GLenum glFormat;
 	GLenum glType;
 	GLenum glAttachment;
-	FosterTextureSampler sampler;
 
 	// Because Shader uniforms assign textures, it's possible for the user to
 	// dispose of a texture but still have it assigned in a shader. Thus we use
@@ -376,6 +463,12 @@ typedef struct FosterTarget_OpenGL
 	int attachmentCount;
 	int colorAttachmentCount;
 	FosterTexture_OpenGL* attachments[FOSTER_MAX_TARGET_ATTACHMENTS];
+
+	// when multisampled, the framebuffer is made of renderbuffers, and
+	// the attachments are in a second framebuffer they're resolved into
+	int samples;
+	GLuint resolveId;
+	GLuint renderbuffers[FOSTER_MAX_TARGET_ATTACHMENTS];
 } FosterTarget_OpenGL;
 
 typedef struct FosterUniform_OpenGL
@@ -386,18 +479,97 @@ typedef struct FosterUniform_OpenGL
 	GLsizei glSize;
 	GLenum glType;
 	int samplerIndex;
+	int valueIndex;
+	int valueSet;
+
+	// std140 layout, if the uniform is a member of a uniform block
+	GLint blockIndex;
+	GLint blockOffset;
+	GLint arrayStride;
+	GLint matrixStride;
 } FosterUniform_OpenGL;
 
+typedef struct FosterUniformBlock_OpenGL
+{
+	GLint size;
+	unsigned char* data;
+	int dirty;
+	int ringGeneration;
+	GLintptr ringOffset;
+} FosterUniformBlock_OpenGL;
+
+// a linked program, shared by every shader created from the same sources
+typedef struct FosterProgram_OpenGL
+{
+	GLuint id;
+	Uint64 key;
+	Uint64 binaryKey;
+	int refCount;
+
+	// sources that haven't been submitted to the driver yet
+	char* vertexSource;
+	char* fragmentSource;
+
+	// shaders that have been submitted to the driver, but not yet validated
+	int pending;
+	GLuint vertexShader;
+	GLuint fragmentShader;
+
+	// non-block uniforms and sampler slots belong to the program, so only the shader
+	// that last uploaded them can trust its shadow copy. see FosterShaderClaimProgram_OpenGL
+	struct FosterShader_OpenGL* owner;
+} FosterProgram_OpenGL;
+
 typedef struct FosterShader_OpenGL
 {
 	GLuint id;
+
+	// the program may be shared with other shaders, and is only copied
+	// into id once it's been compiled & the uniforms have been reflected
+	FosterProgram_OpenGL* program;
+	int reflected;
+
 	GLint uniformCount;
 	GLint samplerCount;
+	GLint valueCount;
+	GLint blockCount;
 	FosterUniform_OpenGL* uniforms;
+	FosterUniformBlock_OpenGL* blocks;
 	FosterTexture_OpenGL* textures[FOSTER_MAX_UNIFORM_TEXTURES];
 	FosterTextureSampler samplers[FOSTER_MAX_UNIFORM_TEXTURES];
+
+	// shadow copy of what has been uploaded to the program, so unchanged values are skipped
+	float* values;
+	GLint textureSlots[FOSTER_MAX_UNIFORM_TEXTURES];
+
+	// the command uniforms last applied, which stay the same while they're in the same submission
+	int appliedSubmit;
+	float* appliedValues;
+	FosterTextureSampler* appliedSamplers;
+	FosterTexture** appliedTextures;
 } FosterShader_OpenGL;
 
+typedef struct FosterSampler_OpenGL
+{
+	FosterTextureSampler sampler;
+	GLuint id;
+} FosterSampler_OpenGL;
+
+typedef struct FosterPipeline_OpenGL
+{
+	FosterPipelineDesc desc;
+
+	// the state converted to GL values up front, so switching pipelines
+	// only has to compare them. depthFunc & cullFace are 0 when disabled.
+	GLenum blendEquation[2];
+	GLenum blendFunc[4];
+	GLboolean colorMask[4];
+	GLfloat blendColor[4];
+	GLenum depthFunc;
+	GLboolean depthMask;
+	GLenum cullFace;
+} FosterPipeline_OpenGL;
+
 typedef struct FosterMesh_OpenGL
 {
 	GLuint id;
@@ -412,8 +584,70 @@ typedef struct FosterMesh_OpenGL
 	int indexSize;
 	int vertexBufferSize;
 	int indexBufferSize;
+	int instanceBufferSize;
+	FosterMeshUsage usage;
+
+	// bytes at the start of each buffer that hold written data, which orphaning would throw away
+	int vertexBufferUsed;
+	int indexBufferUsed;
+	int instanceBufferUsed;
+
+	// copy of the vertex formats, used to point the vertex arrays at
+	// replaced buffers, or wherever the draw's vertices are in the transient ring
+	FosterVertexFormat vertexFormat;
+	FosterVertexFormatElement vertexFormatElements[FOSTER_MAX_VERTEX_FORMAT_ELEMENTS];
+	FosterVertexFormat instanceFormat;
+	FosterVertexFormatElement instanceFormatElements[FOSTER_MAX_VERTEX_FORMAT_ELEMENTS];
+	GLuint transientId;
+	int transientGeneration;
+	GLintptr transientVertexOffset;
+
+	// where the vertex attributes point in the vertex buffer, when base vertices are emulated
+	GLintptr vertexOffset;
+
+	// where the instance attributes currently point in the instance buffer, for each vertex array
+	GLintptr instanceOffset;
+	GLintptr transientInstanceOffset;
 } FosterMesh_OpenGL;
 
+// Transient geometry is bump-allocated from a ring that's split into one segment
+// per frame in flight. When persistently mapped, the segment about to be reused is
+// fenced so it's never written while the GPU may still be reading it. Otherwise the
+// data is staged in CPU memory, uploaded before it's drawn, and the buffer orphaned.
+typedef struct FosterTransientRing_OpenGL
+{
+	GLuint buffer;
+	GLsizeiptr segmentSize;
+	GLintptr segmentStart;
+	GLintptr offset;
+	GLintptr uploaded;
+	int segment;
+	int overflow;
+	unsigned char* mapped;
+	GLsync fences[FOSTER_TRANSIENT_FRAMES];
+} FosterTransientRing_OpenGL;
+
+// A Texture upload waiting for room in the staging ring, or in the frame's budget.
+// The data is copied with its rows tightly packed.
+typedef struct FosterUpload_OpenGL
+{
+	FosterTexture_OpenGL* texture;
+	int x, y, w, h;
+	unsigned char* data;
+} FosterUpload_OpenGL;
+
+typedef struct FosterReadback_OpenGL
+{
+	// pixel pack buffer the texture is copied into, and the fence
+	// signalled once the copy has finished on the GPU
+	GLuint buffer;
+	GLsync fence;
+	int size;
+
+	// data read synchronously when pixel pack buffers aren't usable
+	unsigned char* data;
+} FosterReadback_OpenGL;
+
 typedef struct
 {
 	// GL function pointers
@@ -428,6 +662,7 @@ typedef struct
 	int stateInitializing;
 	int stateActiveTextureSlot;
 	GLuint stateTextureSlots[FOSTER_MAX_UNIFORM_TEXTURES];
+	GLuint stateSamplerSlots[FOSTER_MAX_UNIFORM_TEXTURES];
 	GLuint stateProgram;
 	GLuint stateFrameBuffer;
 	GLuint stateVertexArray;
@@ -442,6 +677,73 @@ typedef struct
 	FosterCull stateCull;
 	FosterBlend stateBlend;
 	int stateDepthMask;
+	FosterPipeline_OpenGL* statePipeline;
+	GLintptr stateUniformBlockOffsets[FOSTER_MAX_UNIFORM_BLOCKS];
+	GLsizeiptr stateUniformBlockSizes[FOSTER_MAX_UNIFORM_BLOCKS];
+
+	// streamed uniform buffer, which uniform blocks are written to every draw.
+	// it's orphaned every frame (or when it fills up), so writes never
+	// have to wait on the GPU.
+	GLuint uniformRing;
+	GLintptr uniformRingOffset;
+	GLsizeiptr uniformRingSize;
+	int uniformRingGeneration;
+	int uniformRingMapped;
+
+	// if immutable buffer & texture storage is supported
+	int bufferStorage;
+	int textureStorage;
+
+	// if texture data can be read back through pixel pack buffers
+	int asyncReadback;
+
+	// if framebuffer contents can be discarded
+	int invalidateFramebuffer;
+
+	// if linked programs are cached to disk, and the hash of the driver they're valid for
+	int programBinary;
+	Uint64 programBinaryDriver;
+
+	// if the driver compiles shaders on its own threads, and can be polled for them
+	int parallelShaderCompile;
+
+	// every live program, so shaders with the same sources share one
+	FosterProgram_OpenGL** programs;
+	int programCount;
+	int programCapacity;
+
+	// staged texture uploads, copied into a pixel unpack ring and uploaded from there.
+	// anything past the ring's room or the frame's budget is queued for later frames.
+	FosterTransientRing_OpenGL uploadRing;
+	FosterUpload_OpenGL* uploads;
+	int uploadCount;
+	int uploadCapacity;
+	int uploadBudget;
+	int uploadFrameBytes;
+	int uploadPendingBytes;
+
+	// transient vertex & index rings, refilled every frame
+	FosterTransientRing_OpenGL transientVertices;
+	FosterTransientRing_OpenGL transientIndices;
+	int transientPersistent;
+	int transientGeneration;
+
+	// if draws can offset their vertices, and scratch arrays for multi-draws
+	int baseVertex;
+	GLint* multiDrawCounts;
+	void** multiDrawIndices;
+	GLint* multiDrawBaseVertices;
+	int multiDrawCapacity;
+
+	// sampler objects, created once for each unique FosterTextureSampler
+	FosterSampler_OpenGL* samplers;
+	int samplerCount;
+
+	// incremented every submission, as command memory may be reused between them
+	int submitCount;
+
+	// counters for the current frame, reset in FosterFrameBegin_OpenGL
+	FosterFrameStats stats;
 
 	// info
 	int max_color_attachments;
@@ -451,6 +753,9 @@ typedef struct
 	int max_samples;
 	int max_texture_image_units;
 	int max_texture_size;
+	int max_array_texture_layers;
+	int max_anisotropy;
+	int uniform_buffer_offset_alignment;
 } FosterOpenGLState;
 
 static FosterOpenGLState fgl;
@@ -510,16 +815,58 @@ GLenum FosterWrapToGL(FosterTextureWrap wrap)
 	}
 }
 
-GLenum FosterFilterToGL(FosterTextureFilter filter)
+GLenum FosterMinFilterToGL(FosterTextureFilter filter)
+{
+	switch (filter)
+	{
+		case FOSTER_TEXTURE_FILTER_NEAREST: return GL_NEAREST;
+		case FOSTER_TEXTURE_FILTER_LINEAR: return GL_LINEAR;
+		case FOSTER_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR: return GL_LINEAR_MIPMAP_LINEAR;
+		default: return GL_NEAREST;
+	}
+}
+
+GLenum FosterMagFilterToGL(FosterTextureFilter filter)
 {
 	switch (filter)
 	{
 		case FOSTER_TEXTURE_FILTER_NEAREST: return GL_NEAREST;
 		case FOSTER_TEXTURE_FILTER_LINEAR: return GL_LINEAR;
+		case FOSTER_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR: return GL_LINEAR;
 		default: return GL_NEAREST;
 	}
 }
 
+// returns 0 when depth testing should be disabled
+GLenum FosterCompareToGL(FosterCompare compare)
+{
+	switch (compare)
+	{
+		case FOSTER_COMPARE_NONE: return 0;
+		case FOSTER_COMPARE_ALWAYS: return GL_ALWAYS;
+		case FOSTER_COMPARE_EQUAL: return GL_EQUAL;
+		case FOSTER_COMPARE_GREATER: return GL_GREATER;
+		case FOSTER_COMPARE_GREATOR_OR_EQUAL: return GL_GEQUAL;
+		case FOSTER_COMPARE_LESS: return GL_LESS;
+		case FOSTER_COMPARE_LESS_OR_EQUAL: return GL_LEQUAL;
+		case FOSTER_COMPARE_NEVER: return GL_NEVER;
+		case FOSTER_COMPARE_NOT_EQUAL: return GL_NOTEQUAL;
+		default: return 0;
+	}
+}
+
+// returns 0 when culling should be disabled
+GLenum FosterCullToGL(FosterCull cull)
+{
+	switch (cull)
+	{
+		case FOSTER_CULL_NONE: return 0;
+		case FOSTER_CULL_BACK: return GL_BACK;
+		case FOSTER_CULL_FRONT: return GL_FRONT;
+		default: return 0;
+	}
+}
+
 GLenum FosterBlendOpToGL(FosterBlendOp operation)
 {
 	switch (operation)
@@ -577,7 +924,27 @@ FosterUniformType FosterUniformTypeFromGL(GLenum value)
 	return FOSTER_UNIFORM_TYPE_NONE;
 }
 
-GLuint FosterMeshAssignAttributes_OpenGL(GLuint buffer, GLenum bufferType, FosterVertexFormat* format, GLint divisor)
+int FosterUniformIsTexture_OpenGL(GLenum value)
+{
+	return value == GL_SAMPLER_2D || value == GL_SAMPLER_2D_ARRAY;
+}
+
+int FosterUniformComponentsFromGL(GLenum value)
+{
+	switch (value)
+	{
+		case GL_FLOAT: return 1;
+		case GL_FLOAT_VEC2: return 2;
+		case GL_FLOAT_VEC3: return 3;
+		case GL_FLOAT_VEC4: return 4;
+		case GL_FLOAT_MAT3x2: return 6;
+		case GL_FLOAT_MAT4: return 16;
+	};
+
+	return 0;
+}
+
+GLuint FosterMeshAssignAttributes_OpenGL(GLuint buffer, GLenum bufferType, FosterVertexFormat* format, GLint divisor, size_t offset)
 {
 	// bind
 	switch (bufferType)
@@ -605,7 +972,7 @@ GLuint FosterMeshAssignAttributes_OpenGL(GLuint buffer, GLenum bufferType, Foste
 	// ...
 
 	// enable attributes
-	size_t ptr = 0;
+	size_t ptr = offset;
 	for (int n = 0; n < format->elementCount; n++)
 	{
 		FosterVertexFormatElement element = format->elements[n];
@@ -697,6 +1064,7 @@ void FosterBindFrameBuffer(FosterTarget_OpenGL* target)
 	{
 		GLenum attachments[4];
 		fgl.glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		fgl.stats.framebufferBinds++;
 
 		// figure out draw buffers
 		if (target == NULL)
@@ -718,35 +1086,42 @@ void FosterBindFrameBuffer(FosterTarget_OpenGL* target)
 void FosterBindProgram(GLuint id)
 {
 	if (fgl.stateInitializing || fgl.stateProgram != id)
+	{
 		fgl.glUseProgram(id);
+		fgl.stats.programBinds++;
+	}
 	fgl.stateProgram = id;
 }
 
 void FosterBindArray(GLuint id)
 {
 	if (fgl.stateInitializing || fgl.stateVertexArray != id)
+	{
 		fgl.glBindVertexArray(id);
+		fgl.stats.stateChanges++;
+	}
 	fgl.stateVertexArray = id;
 }
 
-void FosterBindTexture(int slot, GLuint id)
+void FosterBindTexture(int slot, GLenum target, GLuint id)
 {
 	if (fgl.stateActiveTextureSlot != slot)
 	{
-		fgl.glActiveTexture(GL_TEXTURE0);
+		fgl.glActiveTexture(GL_TEXTURE0 + slot);
 		fgl.stateActiveTextureSlot = slot;
 	}
 
 	if (fgl.stateTextureSlots[slot] != id)
 	{
-		fgl.glBindTexture(GL_TEXTURE_2D, id);
+		fgl.glBindTexture(target, id);
 		fgl.stateTextureSlots[slot] = id;
+		fgl.stats.textureBinds++;
 	}
 }
 
 // Same as FosterBindTexture, except it the resulting global state doesn't
 // necessarily have the slot active or texture bound, if no changes were required.
-void FosterEnsureTextureSlotIs(int slot, GLuint id)
+void FosterEnsureTextureSlotIs(int slot, GLenum target, GLuint id)
 {
 	if (fgl.stateTextureSlots[slot] != id)
 	{
@@ -756,33 +1131,55 @@ void FosterEnsureTextureSlotIs(int slot, GLuint id)
 			fgl.stateActiveTextureSlot = slot;
 		}
 
-		fgl.glBindTexture(GL_TEXTURE_2D, id);
+		fgl.glBindTexture(target, id);
 		fgl.stateTextureSlots[slot] = id;
+		fgl.stats.textureBinds++;
 	}
 }
 
-void FosterSetTextureSampler(FosterTexture_OpenGL* tex, FosterTextureSampler sampler)
+// Gets the Sampler Object for the given sampler state, creating it the first time it's used.
+// There are only a handful of unique sampler states, so a linear search is plenty.
+GLuint FosterGetSampler_OpenGL(FosterTextureSampler sampler)
 {
-	if (!tex->disposed && (
-		tex->sampler.filter != sampler.filter ||
-		tex->sampler.wrapX != sampler.wrapX ||
-		tex->sampler.wrapY != sampler.wrapY))
+	for (int i = 0; i < fgl.samplerCount; i++)
 	{
-		FosterBindTexture(0, tex->id);
+		FosterTextureSampler* it = &fgl.samplers[i].sampler;
+		if (it->filter == sampler.filter &&
+			it->wrapX == sampler.wrapX &&
+			it->wrapY == sampler.wrapY &&
+			it->anisotropy == sampler.anisotropy)
+			return fgl.samplers[i].id;
+	}
 
-		if (tex->sampler.filter != sampler.filter)
-		{
-			fgl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, FosterFilterToGL(sampler.filter));
-			fgl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, FosterFilterToGL(sampler.filter));
-		}
+	GLuint id = 0;
+	fgl.glGenSamplers(1, &id);
+	fgl.glSamplerParameteri(id, GL_TEXTURE_MIN_FILTER, FosterMinFilterToGL(sampler.filter));
+	fgl.glSamplerParameteri(id, GL_TEXTURE_MAG_FILTER, FosterMagFilterToGL(sampler.filter));
+	fgl.glSamplerParameteri(id, GL_TEXTURE_WRAP_S, FosterWrapToGL(sampler.wrapX));
+	fgl.glSamplerParameteri(id, GL_TEXTURE_WRAP_T, FosterWrapToGL(sampler.wrapY));
+
+	// anisotropy is clamped to what the driver supports, and ignored if it has none
+	if (sampler.anisotropy > 1 && fgl.max_anisotropy > 1)
+	{
+		int anisotropy = sampler.anisotropy < fgl.max_anisotropy ? sampler.anisotropy : fgl.max_anisotropy;
+		fgl.glSamplerParameteri(id, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+	}
 
-		if (tex->sampler.wrapX != sampler.wrapX)
-			fgl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, FosterWrapToGL(sampler.wrapX));
+	fgl.samplers = (FosterSampler_OpenGL*)SDL_realloc(fgl.samplers, sizeof(FosterSampler_OpenGL) * (fgl.samplerCount + 1));
+	fgl.samplers[fgl.samplerCount].sampler = sampler;
+	fgl.samplers[fgl.samplerCount].id = id;
+	fgl.samplerCount++;
 
-		if (tex->sampler.wrapY != sampler.wrapY)
-			fgl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, FosterWrapToGL(sampler.wrapY));
+	return id;
+}
 
-		tex->sampler = sampler;
+void FosterBindSampler(int slot, GLuint id)
+{
+	if (fgl.stateSamplerSlots[slot] != id)
+	{
+		fgl.glBindSampler(slot, id);
+		fgl.stateSamplerSlots[slot] = id;
+		fgl.stats.samplerBinds++;
 	}
 }
 
@@ -827,6 +1224,7 @@ void FosterSetViewport(int enabled, FosterRect rect)
 	{
 		fgl.glViewport((GLint)viewport.x, (GLint)viewport.y, (GLint)viewport.w, (GLint)viewport.h);
 		fgl.stateViewport = viewport;
+		fgl.stats.stateChanges++;
 	}
 }
 
@@ -856,6 +1254,7 @@ void FosterSetScissor(int enabled, FosterRect rect)
 		}
 
 		fgl.stateHasScissor = enabled;
+		fgl.stats.stateChanges++;
 	}
 }
 
@@ -868,6 +1267,7 @@ void FosterSetBlend(const FosterBlend* blend)
 		GLenum colorOp = FosterBlendOpToGL(blend->colorOp);
 		GLenum alphaOp = FosterBlendOpToGL(blend->alphaOp);
 		fgl.glBlendEquationSeparate(colorOp, alphaOp);
+		fgl.stats.stateChanges++;
 	}
 
 	if (fgl.stateInitializing ||
@@ -881,6 +1281,7 @@ void FosterSetBlend(const FosterBlend* blend)
 		GLenum alphaSrc = FosterBlendFactorToGL(blend->alphaSrc);
 		GLenum alphaDst = FosterBlendFactorToGL(blend->alphaDst);
 		fgl.glBlendFuncSeparate(colorSrc, colorDst, alphaSrc, alphaDst);
+		fgl.stats.stateChanges++;
 	}
 
 	if (fgl.stateInitializing || fgl.stateBlend.mask != blend->mask)
@@ -890,6 +1291,7 @@ void FosterSetBlend(const FosterBlend* blend)
 			((int)blend->mask & (int)FOSTER_BLEND_MASK_G),
 			((int)blend->mask & (int)FOSTER_BLEND_MASK_B),
 			((int)blend->mask & (int)FOSTER_BLEND_MASK_A));
+		fgl.stats.stateChanges++;
 	}
 
 	if (fgl.stateInitializing || fgl.stateBlend.rgba != blend->rgba)
@@ -904,9 +1306,11 @@ void FosterSetBlend(const FosterBlend* blend)
 			g / 255.0f,
 			b / 255.0f,
 			a / 255.0f);
+		fgl.stats.stateChanges++;
 	}
 
 	fgl.stateBlend = *blend;
+	fgl.statePipeline = NULL;
 }
 
 void FosterSetCompare(FosterCompare compare)
@@ -922,22 +1326,13 @@ void FosterSetCompare(FosterCompare compare)
 			if (fgl.stateCompare == FOSTER_COMPARE_NONE)
 				fgl.glEnable(GL_DEPTH_TEST);
 
-			switch (compare)
-			{
-				case FOSTER_COMPARE_NONE: break;
-				case FOSTER_COMPARE_ALWAYS: fgl.glDepthFunc(GL_ALWAYS); break;
-				case FOSTER_COMPARE_EQUAL: fgl.glDepthFunc(GL_EQUAL); break;
-				case FOSTER_COMPARE_GREATER: fgl.glDepthFunc(GL_GREATER); break;
-				case FOSTER_COMPARE_GREATOR_OR_EQUAL: fgl.glDepthFunc(GL_GEQUAL); break;
-				case FOSTER_COMPARE_LESS: fgl.glDepthFunc(GL_LESS); break;
-				case FOSTER_COMPARE_LESS_OR_EQUAL: fgl.glDepthFunc(GL_LEQUAL); break;
-				case FOSTER_COMPARE_NEVER: fgl.glDepthFunc(GL_NEVER); break;
-				case FOSTER_COMPARE_NOT_EQUAL: fgl.glDepthFunc(GL_NOTEQUAL); break;
-			}
+			fgl.glDepthFunc(FosterCompareToGL(compare));
 		}
+		fgl.stats.stateChanges++;
 	}
 
 	fgl.stateCompare = compare;
+	fgl.statePipeline = NULL;
 }
 
 void FosterSetDepthMask(int depthMask)
@@ -948,9 +1343,11 @@ void FosterSetDepthMask(int depthMask)
 			fgl.glDepthMask(1);
 		else
 			fgl.glDepthMask(0);
+		fgl.stats.stateChanges++;
 	}
 
 	fgl.stateDepthMask = depthMask;
+	fgl.statePipeline = NULL;
 }
 
 void FosterSetCull(FosterCull cull)
@@ -966,216 +1363,1261 @@ void FosterSetCull(FosterCull cull)
 			if (fgl.stateCull == FOSTER_CULL_NONE)
 				fgl.glEnable(GL_CULL_FACE);
 
-			switch (cull)
-			{
-				case FOSTER_CULL_NONE: break;
-				case FOSTER_CULL_BACK: fgl.glCullFace(GL_BACK); break;
-				case FOSTER_CULL_FRONT: fgl.glCullFace(GL_FRONT); break;
-			}
+			fgl.glCullFace(FosterCullToGL(cull));
 		}
+		fgl.stats.stateChanges++;
 	}
 
 	fgl.stateCull = cull;
+	fgl.statePipeline = NULL;
 }
 
-void FosterPrepare_OpenGL()
-{
-	FosterState* state = FosterGetState();
-	state->windowCreateFlags |= SDL_WINDOW_OPENGL;
-
-	#ifdef __EMSCRIPTEN__
-		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
-		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
-	#else
-		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
-		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
-		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
-		SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_FORWARD_COMPATIBLE_FLAG);
-		SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
-
-		// TODO:
-		// This should be controlled via the gfx api somehow?
-		SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
-		SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
-		SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 1);
-		SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 4);
-	#endif
-}
-
-bool FosterInitialize_OpenGL()
+// switches to a pipeline, only touching the GL state that differs from the
+// last one. if state was changed without a pipeline, everything is compared.
+void FosterSetPipeline(FosterPipeline_OpenGL* pipeline)
 {
-	FosterState* state = FosterGetState();
+	FosterPipeline_OpenGL* last = fgl.statePipeline;
+	if (!fgl.stateInitializing && last == pipeline)
+		return;
 
-	// create gl context
-	fgl.context = SDL_GL_CreateContext(state->window);
-	if (fgl.context == NULL)
+	if (fgl.stateInitializing || last == NULL)
 	{
-		FOSTER_LOG_ERROR("Failed to create OpenGL Context: %s", SDL_GetError());
-		return false;
+		FosterSetBlend(&pipeline->desc.blend);
+		FosterSetCompare(pipeline->desc.compare);
+		FosterSetDepthMask(pipeline->desc.depthMask);
+		FosterSetCull(pipeline->desc.cull);
+		fgl.statePipeline = pipeline;
+		return;
 	}
-	SDL_GL_MakeCurrent(state->window, fgl.context);
-
-	// bind opengl functions
-	#define GL_FUNC(name, ...) fgl.gl ## name = (gl ## name ## Fn)(SDL_GL_GetProcAddress("gl" #name));
-	GL_FUNCTIONS
-	#undef GL_FUNC
 
-	// bind debug message callback
-	if (fgl.glDebugMessageCallback != NULL && state->logFilter != FOSTER_LOG_FILTER_IGNORE_ALL)
+	if (SDL_memcmp(last->blendEquation, pipeline->blendEquation, sizeof(pipeline->blendEquation)) != 0)
 	{
-		fgl.glEnable(GL_DEBUG_OUTPUT);
-		fgl.glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-		fgl.glDebugMessageCallback(FosterMessage_OpenGL, NULL);
+		fgl.glBlendEquationSeparate(pipeline->blendEquation[0], pipeline->blendEquation[1]);
+		fgl.stats.stateChanges++;
 	}
 
-	// get opengl info
-	fgl.glGetIntegerv(0x8CDF, &fgl.max_color_attachments);
-	fgl.glGetIntegerv(0x80E9, &fgl.max_element_indices);
-	fgl.glGetIntegerv(0x80E8, &fgl.max_element_vertices);
-	fgl.glGetIntegerv(0x84E8, &fgl.max_renderbuffer_size);
-	fgl.glGetIntegerv(0x8D57, &fgl.max_samples);
-	fgl.glGetIntegerv(0x8872, &fgl.max_texture_image_units);
-	fgl.glGetIntegerv(0x0D33, &fgl.max_texture_size);
+	if (SDL_memcmp(last->blendFunc, pipeline->blendFunc, sizeof(pipeline->blendFunc)) != 0)
+	{
+		fgl.glBlendFuncSeparate(pipeline->blendFunc[0], pipeline->blendFunc[1], pipeline->blendFunc[2], pipeline->blendFunc[3]);
+		fgl.stats.stateChanges++;
+	}
 
-	// don't include row padding
-	fgl.glPixelStorei(GL_PACK_ALIGNMENT, 1);
-	fgl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (SDL_memcmp(last->colorMask, pipeline->colorMask, sizeof(pipeline->colorMask)) != 0)
+	{
+		fgl.glColorMask(pipeline->colorMask[0], pipeline->colorMask[1], pipeline->colorMask[2], pipeline->colorMask[3]);
+		fgl.stats.stateChanges++;
+	}
 
-	// assign info
-	// info.type = RendererType::OpenGL;
-	// info.instancing = true;
-	// info.origin_bottom_left = true;
-	// info.max_texture_size = max_texture_size;
+	if (last->desc.blend.rgba != pipeline->desc.blend.rgba)
+	{
+		fgl.glBlendColor(pipeline->blendColor[0], pipeline->blendColor[1], pipeline->blendColor[2], pipeline->blendColor[3]);
+		fgl.stats.stateChanges++;
+	}
 
-	// Blend State is always enabled
-	fgl.glEnable(GL_BLEND);
+	if (last->depthFunc != pipeline->depthFunc)
+	{
+		if (pipeline->depthFunc == 0)
+			fgl.glDisable(GL_DEPTH_TEST);
+		else
+		{
+			if (last->depthFunc == 0)
+				fgl.glEnable(GL_DEPTH_TEST);
+			fgl.glDepthFunc(pipeline->depthFunc);
+		}
+		fgl.stats.stateChanges++;
+	}
 
-	// set default starting state
-	fgl.stateInitializing = 1;
-	FosterRect zeroRect = { 0 };
-	FosterBlend zeroBlend = { 0 };
-	FosterBindProgram(0);
-	FosterBindFrameBuffer(NULL);
-	FosterBindArray(0);
-	FosterSetViewport(0, zeroRect);
-	FosterSetScissor(0, zeroRect);
-	FosterSetBlend(&zeroBlend);
-	FosterSetCull(FOSTER_CULL_NONE);
-	FosterSetCompare(FOSTER_COMPARE_NONE);
-	FosterSetDepthMask(0);
-	fgl.stateInitializing = 0;
+	if (last->depthMask != pipeline->depthMask)
+	{
+		fgl.glDepthMask(pipeline->depthMask);
+		fgl.stats.stateChanges++;
+	}
 
-	// zero out texture state
-	fgl.stateActiveTextureSlot = 0;
-	fgl.glActiveTexture(GL_TEXTURE0);
-	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
-		fgl.stateTextureSlots[i] = 0;
+	if (last->cullFace != pipeline->cullFace)
+	{
+		if (pipeline->cullFace == 0)
+			fgl.glDisable(GL_CULL_FACE);
+		else
+		{
+			if (last->cullFace == 0)
+				fgl.glEnable(GL_CULL_FACE);
+			fgl.glCullFace(pipeline->cullFace);
+		}
+		fgl.stats.stateChanges++;
+	}
 
-	// log
-	FOSTER_LOG_INFO("OpenGL: v%s, %s", fgl.glGetString(GL_VERSION), fgl.glGetString(GL_RENDERER));
-	return true;
+	fgl.stateBlend = pipeline->desc.blend;
+	fgl.stateCompare = pipeline->desc.compare;
+	fgl.stateDepthMask = pipeline->desc.depthMask;
+	fgl.stateCull = pipeline->desc.cull;
+	fgl.statePipeline = pipeline;
 }
 
-void FosterShutdown_OpenGL()
+// Makes sure there's room for the given number of bytes in the uniform ring.
+// If there isn't, the buffer is orphaned and every uniform block has to re-upload.
+void FosterUniformRingReserve_OpenGL(GLsizeiptr size)
 {
-	SDL_GL_DeleteContext(fgl.context);
-	fgl.context = NULL;
-}
+	GLint align = fgl.uniform_buffer_offset_alignment;
+	GLintptr offset = (fgl.uniformRingOffset + align - 1) / align * align;
 
-void FosterFrameBegin_OpenGL()
-{
+	if (offset + size > fgl.uniformRingSize)
+	{
+		while (size > fgl.uniformRingSize)
+			fgl.uniformRingSize *= 2;
 
+		fgl.glBufferData(GL_UNIFORM_BUFFER, fgl.uniformRingSize, NULL, GL_STREAM_DRAW);
+		fgl.uniformRingOffset = 0;
+		fgl.uniformRingGeneration++;
+	}
 }
 
-void FosterFrameEnd_OpenGL()
+GLintptr FosterUniformRingWrite_OpenGL(const void* data, GLsizeiptr size)
 {
-	FosterState* state = FosterGetState();
+	GLint align = fgl.uniform_buffer_offset_alignment;
+	GLintptr offset = (fgl.uniformRingOffset + align - 1) / align * align;
 
-	// bind 0 to the frame buffer as per SDL's suggestion for macOS:
-	// https://wiki.libsdl.org/SDL2/SDL_GL_SwapWindow#remarks
-	FosterBindFrameBuffer(NULL);
+	// nothing the GPU may still be reading is ever overwritten, so there's no need to sync
+	void* dst = NULL;
+	if (fgl.uniformRingMapped)
+		dst = fgl.glMapBufferRange(GL_UNIFORM_BUFFER, offset, size,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
 
-	SDL_GL_SwapWindow(state->window);
+	if (dst != NULL)
+	{
+		SDL_memcpy(dst, data, size);
+		fgl.glUnmapBuffer(GL_UNIFORM_BUFFER);
+	}
+	else
+	{
+		fgl.glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+	}
+
+	fgl.uniformRingOffset = offset + size;
+	fgl.stats.bufferUploadBytes += (int)size;
+	return offset;
 }
 
-int FosterGetMaxTextureSize_OpenGL()
+void FosterBindUniformBlock(GLuint binding, GLintptr offset, GLsizeiptr size)
 {
-	return fgl.max_texture_size;
+	if (fgl.stateUniformBlockOffsets[binding] != offset || fgl.stateUniformBlockSizes[binding] != size)
+	{
+		fgl.glBindBufferRange(GL_UNIFORM_BUFFER, binding, fgl.uniformRing, offset, size);
+		fgl.stateUniformBlockOffsets[binding] = offset;
+		fgl.stateUniformBlockSizes[binding] = size;
+		fgl.stats.stateChanges++;
+	}
 }
 
-FosterTexture* FosterTextureCreate_OpenGL(int width, int height, FosterTextureFormat format)
+void FosterTransientRingCreate_OpenGL(FosterTransientRing_OpenGL* ring, GLsizeiptr segmentSize)
 {
-	FosterTexture_OpenGL result;
-	FosterTexture_OpenGL* tex = NULL;
-
-	result.id = 0;
-	result.width = width;
-	result.height = height;
-	result.format = format;
-	result.glInternalFormat = GL_RED;
-	result.glFormat = GL_RED;
-	result.glType = GL_UNSIGNED_BYTE;
-	result.refCount = 1;
-	result.disposed = 0;
-	result.sampler.filter = -1;
-	result.sampler.wrapX = -1;
-	result.sampler.wrapY = -1;
-
-	if (width > fgl.max_texture_size || height > fgl.max_texture_size)
+	// only a persistently mapped ring needs a segment per frame, as the others are orphaned
+	GLsizeiptr size = fgl.transientPersistent ? segmentSize * FOSTER_TRANSIENT_FRAMES : segmentSize;
+
+	ring->segmentSize = segmentSize;
+	ring->segmentStart = 0;
+	ring->offset = 0;
+	ring->uploaded = 0;
+	ring->segment = 0;
+	ring->overflow = 0;
+	for (int i = 0; i < FOSTER_TRANSIENT_FRAMES; i++)
+		ring->fences[i] = NULL;
+
+	// vertex arrays pointing at the previous buffer need to be updated,
+	// and a new buffer may well reuse the previous one's name
+	fgl.transientGeneration++;
+
+	// created through the copy target so no vertex array's element buffer is modified
+	fgl.glGenBuffers(1, &ring->buffer);
+	fgl.glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+
+	if (fgl.transientPersistent)
 	{
-		FOSTER_LOG_ERROR("Exceeded Max Texture Size of %i", fgl.max_texture_size);
-		return NULL;
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		fgl.glBufferStorage(GL_COPY_WRITE_BUFFER, size, NULL, flags);
+		ring->mapped = (unsigned char*)fgl.glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
 	}
-
-	switch (format)
+	else
 	{
-		case FOSTER_TEXTURE_FORMAT_R8:
-			result.glInternalFormat = GL_RED;
-			result.glFormat = GL_RED;
-			result.glType = GL_UNSIGNED_BYTE;
-			break;
-		case FOSTER_TEXTURE_FORMAT_R8G8B8A8:
-			result.glInternalFormat = GL_RGBA;
-			result.glFormat = GL_RGBA;
-			result.glType = GL_UNSIGNED_BYTE;
-			break;
-		case FOSTER_TEXTURE_FORMAT_DEPTH24_STENCIL8:
-			result.glInternalFormat = GL_DEPTH24_STENCIL8;
-			result.glFormat = GL_DEPTH_STENCIL;
-			result.glType = GL_UNSIGNED_INT_24_8;
-			break;
-		default:
-			FOSTER_LOG_ERROR("Invalid Texture Format (%i)", format);
-			return NULL;
+		fgl.glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_STREAM_DRAW);
+		ring->mapped = (unsigned char*)SDL_malloc(size);
 	}
+}
 
-	fgl.glGenTextures(1, &result.id);
-	if (result.id == 0)
+void FosterTransientRingDestroy_OpenGL(FosterTransientRing_OpenGL* ring)
+{
+	for (int i = 0; i < FOSTER_TRANSIENT_FRAMES; i++)
 	{
-		FOSTER_LOG_ERROR("Failed to create Texture");
-		return NULL;
+		if (ring->fences[i] != NULL)
+			fgl.glDeleteSync(ring->fences[i]);
+		ring->fences[i] = NULL;
 	}
 
-	FosterBindTexture(0, result.id);
-	fgl.glTexImage2D(GL_TEXTURE_2D, 0, result.glInternalFormat, width, height, 0, result.glFormat, result.glType, NULL);
+	if (!fgl.transientPersistent)
+		SDL_free(ring->mapped);
+	ring->mapped = NULL;
 
-	tex = (FosterTexture_OpenGL*)SDL_malloc(sizeof(FosterTexture_OpenGL));
-	*tex = result;
-	return (FosterTexture*)tex;
+	// deleting a persistently mapped buffer also unmaps it
+	fgl.glDeleteBuffers(1, &ring->buffer);
+	ring->buffer = 0;
 }
 
-void FosterTextureSetData_OpenGL(FosterTexture* texture, void* data, int length)
+// if the ring has room for the data this frame.
+// if not, the ring is marked to be grown when the frame ends.
+int FosterTransientRingFits_OpenGL(FosterTransientRing_OpenGL* ring, int dataSize)
 {
-	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
-	FosterBindTexture(0, tex->id);
-	fgl.glTexImage2D(GL_TEXTURE_2D, 0, tex->glInternalFormat, tex->width, tex->height, 0, tex->glFormat, tex->glType, data);
+	GLintptr start = (ring->offset + 15) & ~(GLintptr)15;
+
+	if (dataSize <= 0 || start + dataSize > ring->segmentSize)
+	{
+		if (dataSize > 0)
+			ring->overflow = 1;
+		return 0;
+	}
+
+	return 1;
 }
 
-void FosterTextureGetData_OpenGL(FosterTexture* texture, void* data, int length)
+void* FosterTransientRingAlloc_OpenGL(FosterTransientRing_OpenGL* ring, int dataSize, int* offset)
 {
-	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
-	FosterBindTexture(0, tex->id);
-	fgl.glGetTexImage(GL_TEXTURE_2D, 0, tex->glInternalFormat, tex->glType, data);
+	if (!FosterTransientRingFits_OpenGL(ring, dataSize))
+		return NULL;
+
+	GLintptr start = (ring->offset + 15) & ~(GLintptr)15;
+	ring->offset = start + dataSize;
+	*offset = (int)(ring->segmentStart + start);
+	return ring->mapped + ring->segmentStart + start;
+}
+
+// uploads anything written to the staging memory since the last upload.
+// does nothing when the ring is persistently mapped.
+void FosterTransientRingUpload_OpenGL(FosterTransientRing_OpenGL* ring)
+{
+	if (fgl.transientPersistent || ring->uploaded >= ring->offset)
+		return;
+
+	fgl.glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	fgl.glBufferSubData(GL_COPY_WRITE_BUFFER, ring->uploaded, ring->offset - ring->uploaded, ring->mapped + ring->uploaded);
+	ring->uploaded = ring->offset;
+}
+
+// blocks until the GPU has signalled the fence, returning 0 if waiting failed
+int FosterWaitFence_OpenGL(GLsync fence)
+{
+	GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	while (true)
+	{
+		GLenum result = fgl.glClientWaitSync(fence, flags, 1000000);
+		if (result != GL_TIMEOUT_EXPIRED)
+			return result != GL_WAIT_FAILED;
+		flags = 0;
+	}
+}
+
+// moves the ring on to the next frame's segment, waiting for the GPU if it's still using it
+void FosterTransientRingAdvance_OpenGL(FosterTransientRing_OpenGL* ring)
+{
+	if (ring->overflow)
+	{
+		GLsizeiptr segmentSize = ring->segmentSize * 2;
+		FOSTER_LOG_INFO("Growing transient buffer to %i bytes per frame", (int)segmentSize);
+		FosterTransientRingDestroy_OpenGL(ring);
+		FosterTransientRingCreate_OpenGL(ring, segmentSize);
+		return;
+	}
+
+	if (!fgl.transientPersistent)
+	{
+		// orphan the buffer so the next frame's uploads don't wait on the GPU
+		if (ring->offset > 0)
+		{
+			fgl.glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+			fgl.glBufferData(GL_COPY_WRITE_BUFFER, ring->segmentSize, NULL, GL_STREAM_DRAW);
+		}
+		ring->offset = 0;
+		ring->uploaded = 0;
+		return;
+	}
+
+	if (ring->offset > 0)
+		ring->fences[ring->segment] = fgl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	ring->segment = (ring->segment + 1) % FOSTER_TRANSIENT_FRAMES;
+	ring->segmentStart = ring->segment * ring->segmentSize;
+	ring->offset = 0;
+
+	GLsync fence = ring->fences[ring->segment];
+	if (fence != NULL)
+	{
+		if (!FosterWaitFence_OpenGL(fence))
+			FOSTER_LOG_ERROR("%s", "Failed waiting on transient buffer fence");
+		fgl.glDeleteSync(fence);
+		ring->fences[ring->segment] = NULL;
+	}
+}
+
+// if an upload of the given size fits in this frame's budget.
+// the first upload of a frame always fits, so large uploads still make progress.
+int FosterUploadFitsBudget_OpenGL(int size)
+{
+	return fgl.uploadBudget <= 0 || fgl.uploadFrameBytes == 0 || fgl.uploadFrameBytes + size <= fgl.uploadBudget;
+}
+
+// copies the rows into the staging ring and uploads the texture from there.
+// returns 0 if the ring is out of room this frame.
+int FosterUploadStage_OpenGL(FosterTexture_OpenGL* tex, int x, int y, int w, int h, const unsigned char* data, int stride)
+{
+	int rowSize = w * tex->pixelSize;
+	int offset = 0;
+	unsigned char* dst = (unsigned char*)FosterTransientRingAlloc_OpenGL(&fgl.uploadRing, rowSize * h, &offset);
+	if (dst == NULL)
+		return 0;
+
+	if (stride == rowSize)
+	{
+		SDL_memcpy(dst, data, (size_t)rowSize * h);
+	}
+	else
+	{
+		for (int row = 0; row < h; row++)
+			SDL_memcpy(dst + (size_t)row * rowSize, data + (size_t)row * stride, rowSize);
+	}
+	FosterTransientRingUpload_OpenGL(&fgl.uploadRing);
+
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	fgl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, fgl.uploadRing.buffer);
+	fgl.glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, tex->glFormat, tex->glType, (void*)(intptr_t)offset);
+	fgl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	fgl.uploadFrameBytes += rowSize * h;
+	fgl.stats.textureUploadBytes += rowSize * h;
+	return 1;
+}
+
+// uploads queued textures in order, until the ring or the frame's budget runs out
+void FosterUploadProcess_OpenGL()
+{
+	int done = 0;
+	while (done < fgl.uploadCount)
+	{
+		FosterUpload_OpenGL* it = &fgl.uploads[done];
+		int rowSize = it->w * it->texture->pixelSize;
+		int size = rowSize * it->h;
+
+		if (!it->texture->disposed)
+		{
+			if (!FosterUploadFitsBudget_OpenGL(size) ||
+				!FosterUploadStage_OpenGL(it->texture, it->x, it->y, it->w, it->h, it->data, rowSize))
+				break;
+		}
+
+		fgl.uploadPendingBytes -= size;
+		FosterTextureReturnReference(it->texture);
+		SDL_free(it->data);
+		done++;
+	}
+
+	if (done > 0)
+	{
+		fgl.uploadCount -= done;
+		SDL_memmove(fgl.uploads, fgl.uploads + done, sizeof(FosterUpload_OpenGL) * fgl.uploadCount);
+	}
+}
+
+// removes a texture's queued uploads, keeping the rest in order. synchronous writes
+// call this first, so older queued data never lands on top of them later. a write
+// that only covers part of the texture flushes the queued uploads instead of dropping them.
+void FosterUploadRemove_OpenGL(FosterTexture_OpenGL* tex, int flush)
+{
+	int count = 0;
+	for (int i = 0; i < fgl.uploadCount; i++)
+	{
+		FosterUpload_OpenGL* it = &fgl.uploads[i];
+		if (it->texture != tex)
+		{
+			fgl.uploads[count++] = *it;
+			continue;
+		}
+
+		int size = it->w * tex->pixelSize * it->h;
+		if (flush && !tex->disposed)
+		{
+			FosterBindTexture(0, tex->glTarget, tex->id);
+			fgl.glTexSubImage2D(GL_TEXTURE_2D, 0, it->x, it->y, it->w, it->h, tex->glFormat, tex->glType, it->data);
+			fgl.stats.textureUploadBytes += size;
+		}
+
+		fgl.uploadPendingBytes -= size;
+		FosterTextureReturnReference(tex);
+		SDL_free(it->data);
+	}
+	fgl.uploadCount = count;
+}
+
+// FNV-1a, used to key cached program binaries
+Uint64 FosterProgramHash_OpenGL(Uint64 hash, const void* data, size_t length)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	for (size_t i = 0; i < length; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+// path to a program binary in the user folder, which must be freed
+char* FosterProgramBinaryPath_OpenGL(Uint64 key)
+{
+	const char* folder = FosterGetUserPath();
+	if (folder == NULL)
+		return NULL;
+
+	size_t length = SDL_strlen(folder) + 32;
+	char* path = (char*)SDL_malloc(length);
+	SDL_snprintf(path, length, "%sshader-%016llx.bin", folder, (unsigned long long)key);
+	return path;
+}
+
+// links a program from a cached binary, returning 0 if it's missing or the driver rejects it
+GLuint FosterProgramBinaryLoad_OpenGL(Uint64 key)
+{
+	char* path = FosterProgramBinaryPath_OpenGL(key);
+	if (path == NULL)
+		return 0;
+
+	size_t length = 0;
+	unsigned char* file = (unsigned char*)SDL_LoadFile(path, &length);
+	SDL_free(path);
+	if (file == NULL)
+		return 0;
+
+	GLuint id = 0;
+	FosterProgramBinaryHeader_OpenGL header;
+	if (length > sizeof(header))
+	{
+		SDL_memcpy(&header, file, sizeof(header));
+		if (header.magic == FOSTER_PROGRAM_BINARY_MAGIC && header.key == key)
+		{
+			id = fgl.glCreateProgram();
+			fgl.glProgramBinary(id, header.format, file + sizeof(header), (GLsizei)(length - sizeof(header)));
+
+			GLint linkResult;
+			fgl.glGetProgramiv(id, GL_LINK_STATUS, &linkResult);
+			if (!linkResult)
+			{
+				fgl.glDeleteProgram(id);
+				id = 0;
+			}
+		}
+	}
+
+	SDL_free(file);
+	return id;
+}
+
+// writes a linked program's binary to the user folder, so later runs can skip compiling it
+void FosterProgramBinarySave_OpenGL(Uint64 key, GLuint id)
+{
+	GLint length = 0;
+	fgl.glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	char* path = FosterProgramBinaryPath_OpenGL(key);
+	if (path == NULL)
+		return;
+
+	FosterProgramBinaryHeader_OpenGL header;
+	header.magic = FOSTER_PROGRAM_BINARY_MAGIC;
+	header.format = 0;
+	header.key = key;
+
+	void* binary = SDL_malloc(length);
+	GLsizei written = 0;
+	fgl.glGetProgramBinary(id, length, &written, &header.format, binary);
+
+	if (written > 0)
+	{
+		SDL_RWops* file = SDL_RWFromFile(path, "wb");
+		if (file != NULL)
+		{
+			SDL_RWwrite(file, &header, sizeof(header), 1);
+			SDL_RWwrite(file, binary, written, 1);
+			SDL_RWclose(file);
+		}
+		else
+		{
+			FOSTER_LOG_WARN("Failed to write shader cache '%s'", path);
+		}
+	}
+
+	SDL_free(binary);
+	SDL_free(path);
+}
+
+void FosterPrepare_OpenGL()
+{
+	FosterState* state = FosterGetState();
+	state->windowCreateFlags |= SDL_WINDOW_OPENGL;
+
+	#ifdef __EMSCRIPTEN__
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
+	#else
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_FORWARD_COMPATIBLE_FLAG);
+		SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+
+		// TODO:
+		// This should be controlled via the gfx api somehow?
+		SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+		SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+	#endif
+
+	if (state->desc.backbufferSamples > 1)
+	{
+		SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 1);
+		SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, state->desc.backbufferSamples);
+	}
+	else
+	{
+		SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 0);
+		SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 0);
+	}
+}
+
+bool FosterInitialize_OpenGL()
+{
+	FosterState* state = FosterGetState();
+
+	// create gl context
+	fgl.context = SDL_GL_CreateContext(state->window);
+	if (fgl.context == NULL)
+	{
+		FOSTER_LOG_ERROR("Failed to create OpenGL Context: %s", SDL_GetError());
+		return false;
+	}
+	SDL_GL_MakeCurrent(state->window, fgl.context);
+
+	// bind opengl functions
+	#define GL_FUNC(name, ...) fgl.gl ## name = (gl ## name ## Fn)(SDL_GL_GetProcAddress("gl" #name));
+	GL_FUNCTIONS
+	#undef GL_FUNC
+
+	// bind debug message callback
+	if (fgl.glDebugMessageCallback != NULL && state->logFilter != FOSTER_LOG_FILTER_IGNORE_ALL)
+	{
+		fgl.glEnable(GL_DEBUG_OUTPUT);
+		fgl.glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+		fgl.glDebugMessageCallback(FosterMessage_OpenGL, NULL);
+	}
+
+	// get opengl info
+	fgl.glGetIntegerv(0x8CDF, &fgl.max_color_attachments);
+	fgl.glGetIntegerv(0x80E9, &fgl.max_element_indices);
+	fgl.glGetIntegerv(0x80E8, &fgl.max_element_vertices);
+	fgl.glGetIntegerv(0x84E8, &fgl.max_renderbuffer_size);
+	fgl.glGetIntegerv(0x8D57, &fgl.max_samples);
+	fgl.glGetIntegerv(0x8872, &fgl.max_texture_image_units);
+	fgl.glGetIntegerv(0x0D33, &fgl.max_texture_size);
+	fgl.glGetIntegerv(0x88FF, &fgl.max_array_texture_layers);
+	fgl.max_anisotropy = 0;
+	if (SDL_GL_ExtensionSupported("GL_EXT_texture_filter_anisotropic") || SDL_GL_ExtensionSupported("GL_ARB_texture_filter_anisotropic"))
+		fgl.glGetIntegerv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &fgl.max_anisotropy);
+	fgl.glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &fgl.uniform_buffer_offset_alignment);
+	if (fgl.uniform_buffer_offset_alignment <= 0)
+		fgl.uniform_buffer_offset_alignment = 256;
+
+	// don't include row padding
+	fgl.glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	fgl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	// assign info
+	// info.type = RendererType::OpenGL;
+	// info.instancing = true;
+	// info.origin_bottom_left = true;
+	// info.max_texture_size = max_texture_size;
+
+	// Blend State is always enabled
+	fgl.glEnable(GL_BLEND);
+
+	// set default starting state
+	fgl.statePipeline = NULL;
+	fgl.stateInitializing = 1;
+	FosterRect zeroRect = { 0 };
+	FosterBlend zeroBlend = { 0 };
+	FosterBindProgram(0);
+	FosterBindFrameBuffer(NULL);
+	FosterBindArray(0);
+	FosterSetViewport(0, zeroRect);
+	FosterSetScissor(0, zeroRect);
+	FosterSetBlend(&zeroBlend);
+	FosterSetCull(FOSTER_CULL_NONE);
+	FosterSetCompare(FOSTER_COMPARE_NONE);
+	FosterSetDepthMask(0);
+	fgl.stateInitializing = 0;
+
+	// zero out texture state
+	fgl.stateActiveTextureSlot = 0;
+	fgl.glActiveTexture(GL_TEXTURE0);
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+	{
+		fgl.stateTextureSlots[i] = 0;
+		fgl.stateSamplerSlots[i] = 0;
+	}
+	fgl.samplers = NULL;
+	fgl.samplerCount = 0;
+	fgl.programs = NULL;
+	fgl.programCount = 0;
+	fgl.programCapacity = 0;
+
+	// create the uniform ring, which stays bound to GL_UNIFORM_BUFFER
+	fgl.uniformRingOffset = 0;
+	fgl.uniformRingSize = 1024 * 1024;
+	fgl.uniformRingGeneration = 0;
+	fgl.glGenBuffers(1, &fgl.uniformRing);
+	fgl.glBindBuffer(GL_UNIFORM_BUFFER, fgl.uniformRing);
+	fgl.glBufferData(GL_UNIFORM_BUFFER, fgl.uniformRingSize, NULL, GL_STREAM_DRAW);
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_BLOCKS; i++)
+	{
+		fgl.stateUniformBlockOffsets[i] = -1;
+		fgl.stateUniformBlockSizes[i] = 0;
+	}
+
+	// WebGL can't map buffers
+	#ifdef __EMSCRIPTEN__
+		fgl.uniformRingMapped = 0;
+	#else
+		fgl.uniformRingMapped = fgl.glMapBufferRange != NULL && fgl.glUnmapBuffer != NULL;
+	#endif
+
+	// immutable buffer storage is core in 4.4, but commonly available as an extension
+	#ifdef __EMSCRIPTEN__
+		fgl.bufferStorage = 0;
+	#else
+		fgl.bufferStorage = fgl.glBufferStorage != NULL && SDL_GL_ExtensionSupported("GL_ARB_buffer_storage");
+	#endif
+
+	// WebGL has no glGetTexImage or buffer mapping, so read backs are synchronous
+	#ifdef __EMSCRIPTEN__
+		fgl.asyncReadback = 0;
+	#else
+		fgl.asyncReadback = fgl.glFenceSync != NULL && fgl.glMapBufferRange != NULL && fgl.glUnmapBuffer != NULL;
+	#endif
+
+	// framebuffer invalidation is core in 4.3 and WebGL 2
+	#ifdef __EMSCRIPTEN__
+		fgl.invalidateFramebuffer = fgl.glInvalidateFramebuffer != NULL;
+	#else
+		fgl.invalidateFramebuffer = fgl.glInvalidateFramebuffer != NULL && SDL_GL_ExtensionSupported("GL_ARB_invalidate_subdata");
+	#endif
+
+	// program binaries are core in 4.1, but WebGL doesn't expose them
+	#ifdef __EMSCRIPTEN__
+		fgl.programBinary = 0;
+	#else
+		fgl.programBinary = 0;
+		if (fgl.glGetProgramBinary != NULL && fgl.glProgramBinary != NULL && fgl.glProgramParameteri != NULL &&
+			SDL_GL_ExtensionSupported("GL_ARB_get_program_binary"))
+		{
+			GLint formats = 0;
+			fgl.glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+			fgl.programBinary = formats > 0;
+		}
+	#endif
+
+	// parallel compilation lets async shaders be polled without blocking
+	fgl.parallelShaderCompile = fgl.glMaxShaderCompilerThreadsKHR != NULL && SDL_GL_ExtensionSupported("GL_KHR_parallel_shader_compile");
+	if (fgl.parallelShaderCompile)
+		fgl.glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+
+	// binaries are only valid for the driver that produced them
+	if (fgl.programBinary)
+	{
+		const char* renderer = (const char*)fgl.glGetString(GL_RENDERER);
+		const char* version = (const char*)fgl.glGetString(GL_VERSION);
+		fgl.programBinaryDriver = FOSTER_PROGRAM_HASH_SEED;
+		if (renderer != NULL)
+			fgl.programBinaryDriver = FosterProgramHash_OpenGL(fgl.programBinaryDriver, renderer, SDL_strlen(renderer) + 1);
+		if (version != NULL)
+			fgl.programBinaryDriver = FosterProgramHash_OpenGL(fgl.programBinaryDriver, version, SDL_strlen(version) + 1);
+	}
+
+	// immutable texture storage is core in 4.2 and WebGL 2
+	#ifdef __EMSCRIPTEN__
+		fgl.textureStorage = fgl.glTexStorage2D != NULL && fgl.glTexStorage3D != NULL;
+	#else
+		fgl.textureStorage = fgl.glTexStorage2D != NULL && fgl.glTexStorage3D != NULL && SDL_GL_ExtensionSupported("GL_ARB_texture_storage");
+	#endif
+
+	// base vertex draws are core in 3.2, but not in WebGL
+	#ifdef __EMSCRIPTEN__
+		fgl.baseVertex = 0;
+	#else
+		fgl.baseVertex = fgl.glDrawElementsBaseVertex != NULL && fgl.glDrawElementsInstancedBaseVertex != NULL;
+	#endif
+
+	// create the transient rings, persistently mapped if the driver can
+	fgl.transientGeneration = 0;
+	fgl.transientPersistent = fgl.bufferStorage && fgl.glFenceSync != NULL;
+	FosterTransientRingCreate_OpenGL(&fgl.transientVertices, 1024 * 1024);
+	FosterTransientRingCreate_OpenGL(&fgl.transientIndices, 256 * 1024);
+	FosterTransientRingCreate_OpenGL(&fgl.uploadRing, FOSTER_UPLOAD_SEGMENT_SIZE);
+	if (fgl.transientPersistent && (fgl.transientVertices.mapped == NULL || fgl.transientIndices.mapped == NULL || fgl.uploadRing.mapped == NULL))
+	{
+		FOSTER_LOG_WARN("%s", "Failed to map transient buffers, falling back to uploading them");
+		FosterTransientRingDestroy_OpenGL(&fgl.transientVertices);
+		FosterTransientRingDestroy_OpenGL(&fgl.transientIndices);
+		FosterTransientRingDestroy_OpenGL(&fgl.uploadRing);
+		fgl.transientPersistent = 0;
+		FosterTransientRingCreate_OpenGL(&fgl.transientVertices, 1024 * 1024);
+		FosterTransientRingCreate_OpenGL(&fgl.transientIndices, 256 * 1024);
+		FosterTransientRingCreate_OpenGL(&fgl.uploadRing, FOSTER_UPLOAD_SEGMENT_SIZE);
+	}
+
+	// log
+	FOSTER_LOG_INFO("OpenGL: v%s, %s", fgl.glGetString(GL_VERSION), fgl.glGetString(GL_RENDERER));
+	return true;
+}
+
+void FosterShutdown_OpenGL()
+{
+	fgl.glDeleteBuffers(1, &fgl.uniformRing);
+	fgl.uniformRing = 0;
+
+	FosterTransientRingDestroy_OpenGL(&fgl.transientVertices);
+	FosterTransientRingDestroy_OpenGL(&fgl.transientIndices);
+	FosterTransientRingDestroy_OpenGL(&fgl.uploadRing);
+
+	for (int i = 0; i < fgl.uploadCount; i++)
+	{
+		FosterTextureReturnReference(fgl.uploads[i].texture);
+		SDL_free(fgl.uploads[i].data);
+	}
+	SDL_free(fgl.uploads);
+	fgl.uploads = NULL;
+	fgl.uploadCount = 0;
+	fgl.uploadCapacity = 0;
+	fgl.uploadPendingBytes = 0;
+
+	SDL_free(fgl.multiDrawCounts);
+	SDL_free(fgl.multiDrawIndices);
+	SDL_free(fgl.multiDrawBaseVertices);
+	fgl.multiDrawCounts = NULL;
+	fgl.multiDrawIndices = NULL;
+	fgl.multiDrawBaseVertices = NULL;
+	fgl.multiDrawCapacity = 0;
+
+	for (int i = 0; i < fgl.samplerCount; i++)
+		fgl.glDeleteSamplers(1, &fgl.samplers[i].id);
+	SDL_free(fgl.samplers);
+	fgl.samplers = NULL;
+	fgl.samplerCount = 0;
+
+	// programs are owned by their shaders, which should all be destroyed by now
+	SDL_free(fgl.programs);
+	fgl.programs = NULL;
+	fgl.programCount = 0;
+	fgl.programCapacity = 0;
+
+	SDL_GL_DeleteContext(fgl.context);
+	fgl.context = NULL;
+}
+
+void FosterFrameBegin_OpenGL()
+{
+	FosterFrameStats zeroStats = { 0 };
+	fgl.stats = zeroStats;
+
+	// orphan last frame's uniform data
+	if (fgl.uniformRingOffset > 0)
+	{
+		fgl.glBufferData(GL_UNIFORM_BUFFER, fgl.uniformRingSize, NULL, GL_STREAM_DRAW);
+		fgl.uniformRingOffset = 0;
+		fgl.uniformRingGeneration++;
+	}
+
+	// continue any uploads that were waiting on the previous frames
+	fgl.uploadFrameBytes = 0;
+	FosterUploadProcess_OpenGL();
+}
+
+void FosterFrameEnd_OpenGL()
+{
+	FosterState* state = FosterGetState();
+
+	// bind 0 to the frame buffer as per SDL's suggestion for macOS:
+	// https://wiki.libsdl.org/SDL2/SDL_GL_SwapWindow#remarks
+	FosterBindFrameBuffer(NULL);
+
+	// everything drawn from the transient rings this frame has been submitted
+	FosterTransientRingAdvance_OpenGL(&fgl.transientVertices);
+	FosterTransientRingAdvance_OpenGL(&fgl.transientIndices);
+
+	// the upload ring only grows up to a limit, past which uploads wait for room
+	if (fgl.uploadRing.overflow && fgl.uploadRing.segmentSize >= FOSTER_UPLOAD_MAX_SEGMENT_SIZE)
+		fgl.uploadRing.overflow = 0;
+	FosterTransientRingAdvance_OpenGL(&fgl.uploadRing);
+
+	SDL_GL_SwapWindow(state->window);
+}
+
+int FosterGetMaxTextureSize_OpenGL()
+{
+	return fgl.max_texture_size;
+}
+
+// Creates a 2D Texture, or a 2D Texture Array if layers is larger than 0
+FosterTexture_OpenGL* FosterTextureInit_OpenGL(int width, int height, int layers, int mipLevels, FosterTextureFormat format)
+{
+	FosterTexture_OpenGL result;
+	FosterTexture_OpenGL* tex = NULL;
+
+	result.id = 0;
+	result.width = width;
+	result.height = height;
+	result.layers = layers;
+	result.mipLevels = mipLevels;
+	result.pixelSize = 1;
+	result.format = format;
+	result.glTarget = layers > 0 ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+	result.glInternalFormat = GL_RED;
+	result.glFormat = GL_RED;
+	result.glType = GL_UNSIGNED_BYTE;
+	result.refCount = 1;
+	result.disposed = 0;
+
+	if (width > fgl.max_texture_size || height > fgl.max_texture_size)
+	{
+		FOSTER_LOG_ERROR("Exceeded Max Texture Size of %i", fgl.max_texture_size);
+		return NULL;
+	}
+
+	if (layers > fgl.max_array_texture_layers)
+	{
+		FOSTER_LOG_ERROR("Exceeded Max Texture Layers of %i", fgl.max_array_texture_layers);
+		return NULL;
+	}
+
+	if (mipLevels < 1 || mipLevels > FosterTextureMaxMipLevels(width, height))
+	{
+		FOSTER_LOG_ERROR("Invalid Texture mip level count (%i)", mipLevels);
+		return NULL;
+	}
+
+	switch (format)
+	{
+		case FOSTER_TEXTURE_FORMAT_R8:
+			result.glInternalFormat = GL_R8;
+			result.glFormat = GL_RED;
+			result.glType = GL_UNSIGNED_BYTE;
+			result.pixelSize = 1;
+			break;
+		case FOSTER_TEXTURE_FORMAT_R8G8B8A8:
+			result.glInternalFormat = GL_RGBA8;
+			result.glFormat = GL_RGBA;
+			result.glType = GL_UNSIGNED_BYTE;
+			result.pixelSize = 4;
+			break;
+		case FOSTER_TEXTURE_FORMAT_DEPTH24_STENCIL8:
+			result.glInternalFormat = GL_DEPTH24_STENCIL8;
+			result.glFormat = GL_DEPTH_STENCIL;
+			result.glType = GL_UNSIGNED_INT_24_8;
+			result.pixelSize = 4;
+			break;
+		case FOSTER_TEXTURE_FORMAT_R8G8:
+			result.glInternalFormat = GL_RG8;
+			result.glFormat = GL_RG;
+			result.glType = GL_UNSIGNED_BYTE;
+			result.pixelSize = 2;
+			break;
+		case FOSTER_TEXTURE_FORMAT_R16F:
+			result.glInternalFormat = GL_R16F;
+			result.glFormat = GL_RED;
+			result.glType = GL_HALF_FLOAT;
+			result.pixelSize = 2;
+			break;
+		case FOSTER_TEXTURE_FORMAT_R16G16B16A16F:
+			result.glInternalFormat = GL_RGBA16F;
+			result.glFormat = GL_RGBA;
+			result.glType = GL_HALF_FLOAT;
+			result.pixelSize = 8;
+			break;
+		case FOSTER_TEXTURE_FORMAT_R32F:
+			result.glInternalFormat = GL_R32F;
+			result.glFormat = GL_RED;
+			result.glType = GL_FLOAT;
+			result.pixelSize = 4;
+			break;
+		case FOSTER_TEXTURE_FORMAT_DEPTH16:
+			result.glInternalFormat = GL_DEPTH_COMPONENT16;
+			result.glFormat = GL_DEPTH_COMPONENT;
+			result.glType = GL_UNSIGNED_SHORT;
+			result.pixelSize = 2;
+			break;
+		case FOSTER_TEXTURE_FORMAT_DEPTH32F:
+			result.glInternalFormat = GL_DEPTH_COMPONENT32F;
+			result.glFormat = GL_DEPTH_COMPONENT;
+			result.glType = GL_FLOAT;
+			result.pixelSize = 4;
+			break;
+		default:
+			FOSTER_LOG_ERROR("Invalid Texture Format (%i)", format);
+			return NULL;
+	}
+
+	fgl.glGenTextures(1, &result.id);
+	if (result.id == 0)
+	{
+		FOSTER_LOG_ERROR("Failed to create Texture");
+		return NULL;
+	}
+
+	// immutable storage lets the driver skip validating the texture on every use
+	FosterBindTexture(0, result.glTarget, result.id);
+	if (fgl.textureStorage && layers > 0)
+		fgl.glTexStorage3D(GL_TEXTURE_2D_ARRAY, mipLevels, result.glInternalFormat, width, height, layers);
+	else if (fgl.textureStorage)
+		fgl.glTexStorage2D(GL_TEXTURE_2D, mipLevels, result.glInternalFormat, width, height);
+	else
+	{
+		for (int level = 0; level < mipLevels; level++)
+		{
+			int w = width >> level > 0 ? width >> level : 1;
+			int h = height >> level > 0 ? height >> level : 1;
+			if (layers > 0)
+				fgl.glTexImage3D(GL_TEXTURE_2D_ARRAY, level, result.glInternalFormat, w, h, layers, 0, result.glFormat, result.glType, NULL);
+			else
+				fgl.glTexImage2D(GL_TEXTURE_2D, level, result.glInternalFormat, w, h, 0, result.glFormat, result.glType, NULL);
+		}
+	}
+
+	// otherwise the texture is incomplete with a mipmap filter until every level exists
+	fgl.glTexParameteri(result.glTarget, GL_TEXTURE_MAX_LEVEL, mipLevels - 1);
+
+	tex = (FosterTexture_OpenGL*)SDL_malloc(sizeof(FosterTexture_OpenGL));
+	*tex = result;
+	return tex;
+}
+
+FosterTexture* FosterTextureCreate_OpenGL(int width, int height, int mipLevels, FosterTextureFormat format)
+{
+	return (FosterTexture*)FosterTextureInit_OpenGL(width, height, 0, mipLevels, format);
+}
+
+FosterTexture* FosterTextureCreateArray_OpenGL(int width, int height, int layers, int mipLevels, FosterTextureFormat format)
+{
+	if (layers <= 0)
+	{
+		FOSTER_LOG_ERROR("Texture Arrays must have at least 1 layer");
+		return NULL;
+	}
+
+	return (FosterTexture*)FosterTextureInit_OpenGL(width, height, layers, mipLevels, format);
+}
+
+void FosterTextureSetData_OpenGL(FosterTexture* texture, void* data, int length)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+	int size = tex->width * tex->height * SDL_max(tex->layers, 1) * tex->pixelSize;
+
+	if (length < size)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: %i bytes given, but the Texture is %i bytes", length, size);
+		return;
+	}
+
+	FosterUploadRemove_OpenGL(tex, 0);
+	FosterBindTexture(0, tex->glTarget, tex->id);
+
+	// the storage is already allocated, so only the contents are replaced
+	if (tex->layers > 0)
+		fgl.glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, tex->width, tex->height, tex->layers, tex->glFormat, tex->glType, data);
+	else
+		fgl.glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, tex->width, tex->height, tex->glFormat, tex->glType, data);
+	fgl.stats.textureUploadBytes += size;
+}
+
+// checks a rectangle of texture data can be set, logging why not
+int FosterTextureCheckRect_OpenGL(FosterTexture_OpenGL* tex, int x, int y, int w, int h, int stride)
+{
+	if (tex->layers > 0)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: Texture Arrays can only be set a layer at a time");
+		return 0;
+	}
+
+	if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > tex->width || y + h > tex->height)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: rectangle [%i, %i, %i, %i] is out of bounds", x, y, w, h);
+		return 0;
+	}
+
+	if (stride > 0 && (stride % tex->pixelSize != 0 || stride < w * tex->pixelSize))
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: invalid stride %i", stride);
+		return 0;
+	}
+
+	return 1;
+}
+
+void FosterTextureSetDataRect_OpenGL(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+
+	if (!FosterTextureCheckRect_OpenGL(tex, x, y, w, h, stride))
+		return;
+
+	FosterUploadRemove_OpenGL(tex, 1);
+
+	// stride is in bytes, but GL wants the row length in pixels
+	int rowLength = 0;
+	if (stride > 0 && stride != w * tex->pixelSize)
+		rowLength = stride / tex->pixelSize;
+
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	if (rowLength > 0)
+		fgl.glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+	fgl.glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, tex->glFormat, tex->glType, data);
+	if (rowLength > 0)
+		fgl.glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	fgl.stats.textureUploadBytes += w * h * tex->pixelSize;
+}
+
+void FosterTextureSetDataAsync_OpenGL(FosterTexture* texture, int x, int y, int w, int h, void* data, int stride)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+
+	if (!FosterTextureCheckRect_OpenGL(tex, x, y, w, h, stride))
+		return;
+
+	int rowSize = w * tex->pixelSize;
+	int size = rowSize * h;
+	if (stride <= 0)
+		stride = rowSize;
+
+	// too large to ever fit in the staging ring
+	if (size > FOSTER_UPLOAD_MAX_SEGMENT_SIZE)
+	{
+		FosterTextureSetDataRect_OpenGL(texture, x, y, w, h, data, stride);
+		return;
+	}
+
+	// uploads stay in order, so only stage immediately if nothing is waiting
+	if (fgl.uploadCount <= 0 && FosterUploadFitsBudget_OpenGL(size) &&
+		FosterUploadStage_OpenGL(tex, x, y, w, h, (unsigned char*)data, stride))
+		return;
+
+	// otherwise keep a copy, to be uploaded on a later frame
+	if (fgl.uploadCount >= fgl.uploadCapacity)
+	{
+		fgl.uploadCapacity = fgl.uploadCapacity > 0 ? fgl.uploadCapacity * 2 : 16;
+		fgl.uploads = (FosterUpload_OpenGL*)SDL_realloc(fgl.uploads, sizeof(FosterUpload_OpenGL) * fgl.uploadCapacity);
+	}
+
+	FosterUpload_OpenGL* upload = &fgl.uploads[fgl.uploadCount++];
+	upload->texture = FosterTextureRequestReference(tex);
+	upload->x = x;
+	upload->y = y;
+	upload->w = w;
+	upload->h = h;
+	upload->data = (unsigned char*)SDL_malloc(size);
+	for (int row = 0; row < h; row++)
+		SDL_memcpy(upload->data + (size_t)row * rowSize, (unsigned char*)data + (size_t)row * stride, rowSize);
+
+	fgl.uploadPendingBytes += size;
+}
+
+void FosterSetUploadBudget_OpenGL(int bytesPerFrame)
+{
+	fgl.uploadBudget = bytesPerFrame;
+}
+
+int FosterGetPendingUploadSize_OpenGL()
+{
+	return fgl.uploadPendingBytes;
+}
+
+void FosterGetFrameStats_OpenGL(FosterFrameStats* stats)
+{
+	*stats = fgl.stats;
+}
+
+void FosterTextureSetLayerData_OpenGL(FosterTexture* texture, int layer, void* data, int length)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+
+	// a regular texture only has the one layer
+	if (tex->layers <= 0 && layer == 0)
+	{
+		FosterTextureSetData_OpenGL(texture, data, length);
+		return;
+	}
+
+	if (layer < 0 || layer >= tex->layers)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: layer %i is out of range", layer);
+		return;
+	}
+
+	int size = tex->width * tex->height * tex->pixelSize;
+	if (length < size)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: %i bytes given, but the Texture layer is %i bytes", length, size);
+		return;
+	}
+
+	// texture arrays can't be uploaded asynchronously, so nothing can be queued for this one
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	fgl.glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, tex->width, tex->height, 1, tex->glFormat, tex->glType, data);
+	fgl.stats.textureUploadBytes += size;
+}
+
+void FosterTextureSetLevelData_OpenGL(FosterTexture* texture, int level, void* data, int length)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+
+	if (level < 0 || level >= tex->mipLevels)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: mip level %i is out of range", level);
+		return;
+	}
+
+	int w = tex->width >> level > 0 ? tex->width >> level : 1;
+	int h = tex->height >> level > 0 ? tex->height >> level : 1;
+	int size = w * h * SDL_max(tex->layers, 1) * tex->pixelSize;
+
+	if (length < size)
+	{
+		FOSTER_LOG_ERROR("Failed to set Texture data: %i bytes given, but mip level %i is %i bytes", length, level, size);
+		return;
+	}
+
+	// queued uploads only ever write to the first level
+	if (level == 0)
+		FosterUploadRemove_OpenGL(tex, 0);
+
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	if (tex->layers > 0)
+		fgl.glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, w, h, tex->layers, tex->glFormat, tex->glType, data);
+	else
+		fgl.glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, w, h, tex->glFormat, tex->glType, data);
+	fgl.stats.textureUploadBytes += size;
+}
+
+void FosterTextureGenerateMipmaps_OpenGL(FosterTexture* texture)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+
+	if (FosterTextureFormatIsDepth(tex->format))
+	{
+		FOSTER_LOG_ERROR("Failed to generate Texture mipmaps: depth Textures can't be filtered");
+		return;
+	}
+
+	if (tex->mipLevels <= 1)
+		return;
+
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	fgl.glGenerateMipmap(tex->glTarget);
+}
+
+void FosterTextureGetData_OpenGL(FosterTexture* texture, void* data, int length)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	fgl.glGetTexImage(tex->glTarget, 0, tex->glFormat, tex->glType, data);
+}
+
+FosterReadback* FosterTextureGetDataAsync_OpenGL(FosterTexture* texture)
+{
+	FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)texture;
+	FosterReadback_OpenGL* readback = (FosterReadback_OpenGL*)SDL_malloc(sizeof(FosterReadback_OpenGL));
+	readback->buffer = 0;
+	readback->fence = NULL;
+	readback->size = tex->width * tex->height * tex->pixelSize * (tex->layers > 0 ? tex->layers : 1);
+	readback->data = NULL;
+
+	if (!fgl.asyncReadback)
+	{
+		readback->data = (unsigned char*)SDL_malloc(readback->size);
+		FosterTextureGetData_OpenGL(texture, readback->data, readback->size);
+		return (FosterReadback*)readback;
+	}
+
+	// copy into a pixel pack buffer, which returns immediately
+	fgl.glGenBuffers(1, &readback->buffer);
+	fgl.glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffer);
+	fgl.glBufferData(GL_PIXEL_PACK_BUFFER, readback->size, NULL, GL_STREAM_READ);
+	FosterBindTexture(0, tex->glTarget, tex->id);
+	fgl.glGetTexImage(tex->glTarget, 0, tex->glFormat, tex->glType, (void*)0);
+	fgl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	readback->fence = fgl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	return (FosterReadback*)readback;
+}
+
+FosterBool FosterReadbackIsReady_OpenGL(FosterReadback* readback)
+{
+	FosterReadback_OpenGL* it = (FosterReadback_OpenGL*)readback;
+
+	if (it->fence == NULL)
+		return 1;
+
+	if (fgl.glClientWaitSync(it->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+		return 0;
+
+	fgl.glDeleteSync(it->fence);
+	it->fence = NULL;
+	return 1;
+}
+
+void FosterReadbackGetData_OpenGL(FosterReadback* readback, void* data, int length)
+{
+	FosterReadback_OpenGL* it = (FosterReadback_OpenGL*)readback;
+	int size = length < it->size ? length : it->size;
+
+	if (it->data != NULL)
+	{
+		SDL_memcpy(data, it->data, size);
+		return;
+	}
+
+	if (it->fence != NULL)
+	{
+		if (!FosterWaitFence_OpenGL(it->fence))
+			FOSTER_LOG_ERROR("%s", "Failed waiting on Texture read back fence");
+		fgl.glDeleteSync(it->fence);
+		it->fence = NULL;
+	}
+
+	fgl.glBindBuffer(GL_PIXEL_PACK_BUFFER, it->buffer);
+	void* mapped = fgl.glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+	if (mapped != NULL)
+	{
+		SDL_memcpy(data, mapped, size);
+		fgl.glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	else
+	{
+		FOSTER_LOG_ERROR("%s", "Failed to map Texture read back buffer");
+	}
+	fgl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FosterReadbackDestroy_OpenGL(FosterReadback* readback)
+{
+	FosterReadback_OpenGL* it = (FosterReadback_OpenGL*)readback;
+
+	if (it->fence != NULL)
+		fgl.glDeleteSync(it->fence);
+	if (it->buffer != 0)
+		fgl.glDeleteBuffers(1, &it->buffer);
+	SDL_free(it->data);
+	SDL_free(it);
 }
 
 void FosterTextureDestroy_OpenGL(FosterTexture* texture)
@@ -1184,11 +2626,14 @@ void FosterTextureDestroy_OpenGL(FosterTexture* texture)
 
 	if (!tex->disposed)
 	{
+		// queued uploads would only be skipped, so free them now
+		FosterUploadRemove_OpenGL(tex, 0);
+
 		// make sure this isn't bound anymore
 		for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i ++)
 		{
 			if (fgl.stateTextureSlots[i] == tex->id)
-				FosterBindTexture(i, 0);
+				FosterBindTexture(i, tex->glTarget, 0);
 		}
 
 		// delete it
@@ -1198,7 +2643,7 @@ void FosterTextureDestroy_OpenGL(FosterTexture* texture)
 	}
 }
 
-FosterTarget* FosterTargetCreate_OpenGL(int width, int height, FosterTextureFormat* attachments, int attachmentCount)
+FosterTarget* FosterTargetCreate_OpenGL(int width, int height, int samples, FosterTextureFormat* attachments, int attachmentCount)
 {
 	FosterTarget_OpenGL result;
 	result.id = 0;
@@ -1206,8 +2651,19 @@ FosterTarget* FosterTargetCreate_OpenGL(int width, int height, FosterTextureForm
 	result.height = height;
 	result.attachmentCount = attachmentCount;
 	result.colorAttachmentCount = 0;
+	result.samples = samples > 1 ? samples : 1;
+	result.resolveId = 0;
 	for (int i = 0; i < FOSTER_MAX_TARGET_ATTACHMENTS; i++)
+	{
 		result.attachments[i] = NULL;
+		result.renderbuffers[i] = 0;
+	}
+
+	if (result.samples > fgl.max_samples)
+	{
+		FOSTER_LOG_WARN("Target samples (%i) exceeds Max Samples of %i", result.samples, fgl.max_samples);
+		result.samples = fgl.max_samples > 1 ? fgl.max_samples : 1;
+	}
 
 	fgl.glGenFramebuffers(1, &result.id);
 	fgl.glBindFramebuffer(GL_FRAMEBUFFER, result.id);
@@ -1215,12 +2671,18 @@ FosterTarget* FosterTargetCreate_OpenGL(int width, int height, FosterTextureForm
 
 	for (int i = 0; i < attachmentCount; i++)
 	{
-		FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)FosterTextureCreate_OpenGL(width, height, attachments[i]);
+		FosterTexture_OpenGL* tex = (FosterTexture_OpenGL*)FosterTextureCreate_OpenGL(width, height, 1, attachments[i]);
 
 		if (tex == NULL)
 		{
 			for (int j = 0; j < i; j++)
-				FosterTextureDestroy_OpenGL((FosterTexture*)tex);
+			{
+				FosterTextureDestroy_OpenGL((FosterTexture*)result.attachments[j]);
+				if (result.renderbuffers[j] != 0)
+					fgl.glDeleteRenderbuffers(1, &result.renderbuffers[j]);
+			}
+			fgl.glDeleteFramebuffers(1, &result.id);
+			fgl.stateFrameBuffer = 0;
 			FOSTER_LOG_ERROR("Failed to create Target Attachment");
 			FosterBindFrameBuffer(NULL);
 			return NULL;
@@ -1232,13 +2694,38 @@ FosterTarget* FosterTargetCreate_OpenGL(int width, int height, FosterTextureForm
 		{
 			tex->glAttachment = GL_DEPTH_STENCIL_ATTACHMENT;
 		}
+		else if (FosterTextureFormatIsDepth(attachments[i]))
+		{
+			tex->glAttachment = GL_DEPTH_ATTACHMENT;
+		}
 		else
 		{
 			tex->glAttachment = GL_COLOR_ATTACHMENT0 + result.colorAttachmentCount;
 			result.colorAttachmentCount++;
 		}
 
-		fgl.glFramebufferTexture2D(GL_FRAMEBUFFER, tex->glAttachment, GL_TEXTURE_2D, tex->id, 0);
+		// multisampled targets are drawn to a renderbuffer, which is resolved into the texture
+		if (result.samples > 1)
+		{
+			fgl.glGenRenderbuffers(1, &result.renderbuffers[i]);
+			fgl.glBindRenderbuffer(GL_RENDERBUFFER, result.renderbuffers[i]);
+			fgl.glRenderbufferStorageMultisample(GL_RENDERBUFFER, result.samples, tex->glInternalFormat, width, height);
+			fgl.glFramebufferRenderbuffer(GL_FRAMEBUFFER, tex->glAttachment, GL_RENDERBUFFER, result.renderbuffers[i]);
+		}
+		else
+		{
+			fgl.glFramebufferTexture2D(GL_FRAMEBUFFER, tex->glAttachment, GL_TEXTURE_2D, tex->id, 0);
+		}
+	}
+
+	if (result.samples > 1)
+	{
+		fgl.glGenFramebuffers(1, &result.resolveId);
+		fgl.glBindFramebuffer(GL_FRAMEBUFFER, result.resolveId);
+		fgl.stateFrameBuffer = result.resolveId;
+
+		for (int i = 0; i < attachmentCount; i++)
+			fgl.glFramebufferTexture2D(GL_FRAMEBUFFER, result.attachments[i]->glAttachment, GL_TEXTURE_2D, result.attachments[i]->id, 0);
 	}
 
 	// since we manually set the framebuffer above, clear buffer assignment to maintain correct state
@@ -1250,10 +2737,53 @@ FosterTarget* FosterTargetCreate_OpenGL(int width, int height, FosterTextureForm
 	return (FosterTarget*)tar;
 }
 
-FosterTexture* FosterTargetGetAttachment_OpenGL(FosterTarget* target, int index)
-{
-	FosterTarget_OpenGL* tar = (FosterTarget_OpenGL*)target;
-	return (FosterTexture*)tar->attachments[index];
+FosterTexture* FosterTargetGetAttachment_OpenGL(FosterTarget* target, int index)
+{
+	FosterTarget_OpenGL* tar = (FosterTarget_OpenGL*)target;
+	return (FosterTexture*)tar->attachments[index];
+}
+
+void FosterTargetResolve_OpenGL(FosterTarget* target)
+{
+	FosterTarget_OpenGL* tar = (FosterTarget_OpenGL*)target;
+
+	if (tar->resolveId == 0)
+		return;
+
+	// blits are clipped by the scissor
+	if (fgl.stateHasScissor)
+		fgl.glDisable(GL_SCISSOR_TEST);
+
+	fgl.glBindFramebuffer(GL_READ_FRAMEBUFFER, tar->id);
+	fgl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, tar->resolveId);
+
+	for (int i = 0; i < tar->attachmentCount; i++)
+	{
+		GLenum attachment = tar->attachments[i]->glAttachment;
+
+		if (attachment == GL_DEPTH_STENCIL_ATTACHMENT)
+		{
+			fgl.glBlitFramebuffer(0, 0, tar->width, tar->height, 0, 0, tar->width, tar->height,
+				GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT, GL_NEAREST);
+		}
+		else if (attachment == GL_DEPTH_ATTACHMENT)
+		{
+			fgl.glBlitFramebuffer(0, 0, tar->width, tar->height, 0, 0, tar->width, tar->height,
+				GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+		}
+		else
+		{
+			// color attachments are resolved one at a time
+			fgl.glReadBuffer(attachment);
+			fgl.glDrawBuffers(1, &attachment);
+			fgl.glBlitFramebuffer(0, 0, tar->width, tar->height, 0, 0, tar->width, tar->height,
+				GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		}
+	}
+
+	fgl.glBindFramebuffer(GL_FRAMEBUFFER, fgl.stateFrameBuffer);
+	if (fgl.stateHasScissor)
+		fgl.glEnable(GL_SCISSOR_TEST);
 }
 
 void FosterTargetDestroy_OpenGL(FosterTarget* target)
@@ -1264,123 +2794,228 @@ void FosterTargetDestroy_OpenGL(FosterTarget* target)
 	{
 		if (tar->attachments[i] != NULL)
 			FosterTextureDestroy_OpenGL((FosterTexture*)tar->attachments[i]);
+		if (tar->renderbuffers[i] != 0)
+			fgl.glDeleteRenderbuffers(1, &tar->renderbuffers[i]);
 	}
 
+	if (tar->resolveId != 0)
+		fgl.glDeleteFramebuffers(1, &tar->resolveId);
 	fgl.glDeleteFramebuffers(1, &tar->id);
 	SDL_free(tar);
 }
 
-FosterShader* FosterShaderCreate_OpenGL(FosterShaderData* data)
+// finds the program for the given sources, creating it if nothing uses it yet.
+// identical sources share a program, so every variant is only compiled once.
+FosterProgram_OpenGL* FosterProgramRequest_OpenGL(FosterShaderData* data)
 {
-	GLchar log[1024] = { 0 };
-	GLsizei logLength = 0;
-	GLuint vertexShader;
-	GLuint fragmentShader;
-	const GLchar* source;
+	char* vertex = FosterShaderApplyDefines((const char*)data->vertexShader, data->defines);
+	char* fragment = FosterShaderApplyDefines((const char*)data->fragmentShader, data->defines);
 
-	if (data->vertexShader == NULL)
+	Uint64 key = FOSTER_PROGRAM_HASH_SEED;
+	key = FosterProgramHash_OpenGL(key, vertex, SDL_strlen(vertex) + 1);
+	key = FosterProgramHash_OpenGL(key, fragment, SDL_strlen(fragment) + 1);
+
+	for (int i = 0; i < fgl.programCount; i++)
 	{
-		FOSTER_LOG_ERROR("Invalid Vertex Shader");
-		return NULL;
+		FosterProgram_OpenGL* it = fgl.programs[i];
+		if (it->key == key)
+		{
+			SDL_free(vertex);
+			SDL_free(fragment);
+			it->refCount++;
+			return it;
+		}
 	}
 
-	if (data->fragmentShader == NULL)
+	FosterProgram_OpenGL* program = (FosterProgram_OpenGL*)SDL_malloc(sizeof(FosterProgram_OpenGL));
+	program->id = 0;
+	program->key = key;
+	program->binaryKey = 0;
+	program->refCount = 1;
+	program->vertexSource = vertex;
+	program->fragmentSource = fragment;
+	program->pending = 0;
+	program->vertexShader = 0;
+	program->fragmentShader = 0;
+	program->owner = NULL;
+
+	// try the binary cache, which is keyed by the source and the driver
+	if (fgl.programBinary)
 	{
-		FOSTER_LOG_ERROR("Invalid Fragment Shader");
-		return NULL;
+		program->binaryKey = FosterProgramHash_OpenGL(fgl.programBinaryDriver, &key, sizeof(key));
+		program->id = FosterProgramBinaryLoad_OpenGL(program->binaryKey);
+		if (program->id != 0)
+		{
+			SDL_free(program->vertexSource);
+			SDL_free(program->fragmentSource);
+			program->vertexSource = NULL;
+			program->fragmentSource = NULL;
+		}
 	}
 
-	vertexShader = fgl.glCreateShader(GL_VERTEX_SHADER);
+	if (fgl.programCount >= fgl.programCapacity)
 	{
-		source = (const GLchar*)data->vertexShader;
-		fgl.glShaderSource(vertexShader, 1, &source, NULL);
-		fgl.glCompileShader(vertexShader);
-		fgl.glGetShaderInfoLog(vertexShader, 1024, &logLength, log);
+		fgl.programCapacity = fgl.programCapacity > 0 ? fgl.programCapacity * 2 : 32;
+		fgl.programs = (FosterProgram_OpenGL**)SDL_realloc(fgl.programs, sizeof(FosterProgram_OpenGL*) * fgl.programCapacity);
+	}
+	fgl.programs[fgl.programCount++] = program;
 
-		GLint params;
-		fgl.glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &params);
+	return program;
+}
 
-		// validate shader
-		if (!params)
-		{
-			fgl.glDeleteShader(vertexShader);
-			if (logLength > 0)
-				FOSTER_LOG_ERROR("%s", log);
-			return NULL;
-		}
-		else if (logLength > 0)
+void FosterProgramRelease_OpenGL(FosterProgram_OpenGL* program)
+{
+	program->refCount--;
+	if (program->refCount > 0)
+		return;
+
+	for (int i = 0; i < fgl.programCount; i++)
+	{
+		if (fgl.programs[i] == program)
 		{
-			FOSTER_LOG_INFO("%s", log);
+			fgl.programs[i] = fgl.programs[--fgl.programCount];
+			break;
 		}
 	}
 
-	fragmentShader = fgl.glCreateShader(GL_FRAGMENT_SHADER);
+	if (program->pending)
 	{
-		source = (const GLchar*)data->fragmentShader;
-		fgl.glShaderSource(fragmentShader, 1, &source, NULL);
-		fgl.glCompileShader(fragmentShader);
-		fgl.glGetShaderInfoLog(fragmentShader, 1024, &logLength, log);
+		fgl.glDeleteShader(program->vertexShader);
+		fgl.glDeleteShader(program->fragmentShader);
+	}
+	if (program->id != 0)
+		fgl.glDeleteProgram(program->id);
+	SDL_free(program->vertexSource);
+	SDL_free(program->fragmentSource);
+	SDL_free(program);
+}
 
-		GLint params;
-		fgl.glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &params);
+// starts compiling & linking a program, without waiting on the results, which
+// lets the driver work on it in the background until it's validated
+void FosterProgramSubmit_OpenGL(FosterProgram_OpenGL* program)
+{
+	if (program->vertexSource == NULL)
+		return;
 
-		// validate shader
-		if (!params)
-		{
-			fgl.glDeleteShader(vertexShader);
-			fgl.glDeleteShader(fragmentShader);
-			if (logLength > 0)
-				FOSTER_LOG_ERROR("%s", log);
-			return NULL;
-		}
+	const GLchar* source;
+
+	program->vertexShader = fgl.glCreateShader(GL_VERTEX_SHADER);
+	source = (const GLchar*)program->vertexSource;
+	fgl.glShaderSource(program->vertexShader, 1, &source, NULL);
+	fgl.glCompileShader(program->vertexShader);
+
+	program->fragmentShader = fgl.glCreateShader(GL_FRAGMENT_SHADER);
+	source = (const GLchar*)program->fragmentSource;
+	fgl.glShaderSource(program->fragmentShader, 1, &source, NULL);
+	fgl.glCompileShader(program->fragmentShader);
+
+	// create actual shader program
+	program->id = fgl.glCreateProgram();
+	fgl.glAttachShader(program->id, program->vertexShader);
+	fgl.glAttachShader(program->id, program->fragmentShader);
+	if (fgl.programBinary)
+		fgl.glProgramParameteri(program->id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+	fgl.glLinkProgram(program->id);
+	program->pending = 1;
+
+	SDL_free(program->vertexSource);
+	SDL_free(program->fragmentSource);
+	program->vertexSource = NULL;
+	program->fragmentSource = NULL;
+}
+
+// validates a submitted program, blocking if the driver is still working on it.
+// the shaders are released either way, and the id is left as 0 if anything failed.
+void FosterProgramValidate_OpenGL(FosterProgram_OpenGL* program)
+{
+	GLchar log[1024] = { 0 };
+	GLsizei logLength = 0;
+	GLint vertexResult;
+	GLint fragmentResult;
+	GLint linkResult;
+	GLuint id = program->id;
+
+	program->pending = 0;
+
+	// validate shaders
+	GLuint shaders[2] = { program->vertexShader, program->fragmentShader };
+	GLint* results[2] = { &vertexResult, &fragmentResult };
+	for (int i = 0; i < 2; i++)
+	{
+		fgl.glGetShaderiv(shaders[i], GL_COMPILE_STATUS, results[i]);
+		fgl.glGetShaderInfoLog(shaders[i], 1024, &logLength, log);
+
+		if (!*results[i] && logLength > 0)
+			FOSTER_LOG_ERROR("%s", log);
 		else if (logLength > 0)
-		{
 			FOSTER_LOG_INFO("%s", log);
-		}
 	}
 
-	// create actual shader program
-	GLuint id = fgl.glCreateProgram();
-	fgl.glAttachShader(id, vertexShader);
-	fgl.glAttachShader(id, fragmentShader);
-	fgl.glLinkProgram(id);
-	fgl.glGetProgramInfoLog(id, 1024, &logLength, log);
-	fgl.glDetachShader(id, vertexShader);
-	fgl.glDetachShader(id, fragmentShader);
-	fgl.glDeleteShader(vertexShader);
-	fgl.glDeleteShader(fragmentShader);
+	fgl.glDetachShader(id, program->vertexShader);
+	fgl.glDetachShader(id, program->fragmentShader);
+	fgl.glDeleteShader(program->vertexShader);
+	fgl.glDeleteShader(program->fragmentShader);
+	program->vertexShader = 0;
+	program->fragmentShader = 0;
+
+	if (!vertexResult || !fragmentResult)
+	{
+		fgl.glDeleteProgram(id);
+		program->id = 0;
+		return;
+	}
 
 	// validate link status
-	GLint linkResult;
 	fgl.glGetProgramiv(id, GL_LINK_STATUS, &linkResult);
+	fgl.glGetProgramInfoLog(id, 1024, &logLength, log);
 
 	if (!linkResult)
 	{
+		fgl.glDeleteProgram(id);
+		program->id = 0;
 		if (logLength > 0)
 			FOSTER_LOG_ERROR("%s", log);
-		return NULL;
+		return;
 	}
 	else if (logLength > 0)
 	{
 		FOSTER_LOG_INFO("%s", log);
 	}
 
-	FosterShader_OpenGL* shader = (FosterShader_OpenGL*)SDL_malloc(sizeof(FosterShader_OpenGL));
-	shader->id = id;
-	shader->samplerCount = 0;
-	shader->uniformCount = 0;
-	shader->uniforms = NULL;
+	if (fgl.programBinary)
+		FosterProgramBinarySave_OpenGL(program->binaryKey, id);
+}
 
-	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+// queries the uniforms & blocks of a linked program and caches them
+void FosterShaderReflect_OpenGL(FosterShader_OpenGL* shader)
+{
+	// query uniform blocks, each is bound to the binding point matching its index
+	fgl.glGetProgramiv(shader->id, GL_ACTIVE_UNIFORM_BLOCKS, &shader->blockCount);
+
+	if (shader->blockCount > FOSTER_MAX_UNIFORM_BLOCKS)
 	{
-		shader->textures[i] = NULL;
-		shader->samplers[i].filter = FOSTER_TEXTURE_FILTER_LINEAR;
-		shader->samplers[i].wrapX = FOSTER_TEXTURE_WRAP_CLAMP_TO_EDGE;
-		shader->samplers[i].wrapY = FOSTER_TEXTURE_WRAP_CLAMP_TO_EDGE;
+		FOSTER_LOG_WARN("Shader has %i Uniform Blocks, but only %i are supported", shader->blockCount, FOSTER_MAX_UNIFORM_BLOCKS);
+		shader->blockCount = FOSTER_MAX_UNIFORM_BLOCKS;
+	}
+
+	if (shader->blockCount > 0)
+	{
+		shader->blocks = (FosterUniformBlock_OpenGL*)SDL_malloc(sizeof(FosterUniformBlock_OpenGL) * shader->blockCount);
+
+		for (int i = 0; i < shader->blockCount; i++)
+		{
+			FosterUniformBlock_OpenGL* block = shader->blocks + i;
+			fgl.glGetActiveUniformBlockiv(shader->id, i, GL_UNIFORM_BLOCK_DATA_SIZE, &block->size);
+			fgl.glUniformBlockBinding(shader->id, i, i);
+			block->data = (unsigned char*)SDL_calloc(1, block->size);
+			block->dirty = 1;
+			block->ringGeneration = -1;
+			block->ringOffset = 0;
+		}
 	}
 
 	// query uniforms and cache them
-	fgl.glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &shader->uniformCount);
+	fgl.glGetProgramiv(shader->id, GL_ACTIVE_UNIFORMS, &shader->uniformCount);
 
 	if (shader->uniformCount > 0)
 	{
@@ -1395,11 +3030,29 @@ FosterShader* FosterShaderCreate_OpenGL(FosterShaderData* data)
 			uniform->name = NULL;
 			uniform->samplerName = NULL;
 			uniform->samplerIndex = 0;
+			uniform->valueIndex = 0;
+			uniform->valueSet = 0;
+			uniform->blockIndex = -1;
+			uniform->blockOffset = 0;
+			uniform->arrayStride = 0;
+			uniform->matrixStride = 0;
 
 			// get the name & properties
 			GLsizei nameLen;
 			char nameBuf[256];
-			fgl.glGetActiveUniform(id, i, 255, &nameLen, &uniform->glSize, &uniform->glType, nameBuf);
+			fgl.glGetActiveUniform(shader->id, i, 255, &nameLen, &uniform->glSize, &uniform->glType, nameBuf);
+
+			// get the block layout, which isn't packed the same as our values
+			if (shader->blockCount > 0)
+			{
+				GLuint index = (GLuint)i;
+				fgl.glGetActiveUniformsiv(shader->id, 1, &index, GL_UNIFORM_BLOCK_INDEX, &uniform->blockIndex);
+				fgl.glGetActiveUniformsiv(shader->id, 1, &index, GL_UNIFORM_OFFSET, &uniform->blockOffset);
+				fgl.glGetActiveUniformsiv(shader->id, 1, &index, GL_UNIFORM_ARRAY_STRIDE, &uniform->arrayStride);
+				fgl.glGetActiveUniformsiv(shader->id, 1, &index, GL_UNIFORM_MATRIX_STRIDE, &uniform->matrixStride);
+				if (uniform->blockIndex >= shader->blockCount)
+					uniform->blockIndex = -1;
+			}
 
 			// array names end with "[0]", and we don't want that
 			for (int n = 0; n < nameLen - 2; n++)
@@ -1415,25 +3068,163 @@ FosterShader* FosterShaderCreate_OpenGL(FosterShaderData* data)
 			SDL_strlcpy(uniform->name, nameBuf, nameLen + 1);
 
 			// get GL location
-			uniform->glLocation = fgl.glGetUniformLocation(id, uniform->name);
+			uniform->glLocation = fgl.glGetUniformLocation(shader->id, uniform->name);
 
 			// if we're a sampler we need a unique sampler name + track what sampler index
-			if (uniform->glType == GL_SAMPLER_2D)
+			if (FosterUniformIsTexture_OpenGL(uniform->glType))
 			{
 				uniform->samplerName = (char*)SDL_malloc(nameLen + 16);
 				SDL_snprintf(uniform->samplerName, nameLen + 16, "%s_sampler", uniform->name);
 				uniform->samplerIndex = shader->samplerCount;
 				shader->samplerCount += uniform->glSize;
 			}
+			// otherwise track where our values start in a packed uniform value buffer
+			else
+			{
+				uniform->valueIndex = shader->valueCount;
+				shader->valueCount += uniform->glSize * FosterUniformComponentsFromGL(uniform->glType);
+			}
+		}
+	}
+
+	if (shader->valueCount > 0)
+		shader->values = (float*)SDL_calloc(shader->valueCount, sizeof(float));
+}
+
+// makes the shader the owner of its program's uniforms. if another shader sharing
+// the program uploaded since, this shader's shadow copy is stale and is reset,
+// so its values are uploaded again instead of skipped.
+void FosterShaderClaimProgram_OpenGL(FosterShader_OpenGL* shader)
+{
+	FosterProgram_OpenGL* program = shader->program;
+	if (program->owner == shader)
+		return;
+
+	for (int i = 0; i < shader->uniformCount; i++)
+		shader->uniforms[i].valueSet = 0;
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+		shader->textureSlots[i] = -1;
+
+	shader->appliedSubmit = -1;
+	shader->appliedValues = NULL;
+	shader->appliedSamplers = NULL;
+	shader->appliedTextures = NULL;
+	program->owner = shader;
+}
+
+// finishes a shader, compiling its program first if it hasn't been yet.
+// if that failed its id is left as 0, and it has no uniforms.
+void FosterShaderFinish_OpenGL(FosterShader_OpenGL* shader)
+{
+	if (shader->reflected)
+		return;
+
+	FosterProgram_OpenGL* program = shader->program;
+	FosterProgramSubmit_OpenGL(program);
+	if (program->pending)
+		FosterProgramValidate_OpenGL(program);
+
+	shader->reflected = 1;
+	shader->id = program->id;
+	if (shader->id != 0)
+		FosterShaderReflect_OpenGL(shader);
+}
+
+// creates a shader, sharing the program of any other shader with the same sources.
+// variants with defines are compiled on first use, async shaders are submitted
+// to the driver right away, and anything else is finished immediately.
+FosterShader* FosterShaderSubmit_OpenGL(FosterShaderData* data, int async)
+{
+	if (data->vertexShader == NULL)
+	{
+		FOSTER_LOG_ERROR("Invalid Vertex Shader");
+		return NULL;
+	}
+
+	if (data->fragmentShader == NULL)
+	{
+		FOSTER_LOG_ERROR("Invalid Fragment Shader");
+		return NULL;
+	}
+
+	FosterShader_OpenGL* shader = (FosterShader_OpenGL*)SDL_malloc(sizeof(FosterShader_OpenGL));
+	shader->id = 0;
+	shader->program = FosterProgramRequest_OpenGL(data);
+	shader->reflected = 0;
+	shader->samplerCount = 0;
+	shader->valueCount = 0;
+	shader->uniformCount = 0;
+	shader->uniforms = NULL;
+	shader->blockCount = 0;
+	shader->blocks = NULL;
+	shader->values = NULL;
+	shader->appliedSubmit = -1;
+	shader->appliedValues = NULL;
+	shader->appliedSamplers = NULL;
+	shader->appliedTextures = NULL;
+
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+	{
+		shader->textures[i] = NULL;
+		shader->textureSlots[i] = -1;
+		shader->samplers[i].filter = FOSTER_TEXTURE_FILTER_LINEAR;
+		shader->samplers[i].wrapX = FOSTER_TEXTURE_WRAP_CLAMP_TO_EDGE;
+		shader->samplers[i].wrapY = FOSTER_TEXTURE_WRAP_CLAMP_TO_EDGE;
+		shader->samplers[i].anisotropy = 0;
+	}
+
+	if (async)
+	{
+		FosterProgramSubmit_OpenGL(shader->program);
+	}
+	else if (data->defines == NULL)
+	{
+		FosterShaderFinish_OpenGL(shader);
+		if (shader->id == 0)
+		{
+			FosterProgramRelease_OpenGL(shader->program);
+			SDL_free(shader);
+			return NULL;
 		}
 	}
 
 	return (FosterShader*)shader;
 }
 
+FosterShader* FosterShaderCreate_OpenGL(FosterShaderData* data)
+{
+	return FosterShaderSubmit_OpenGL(data, 0);
+}
+
+FosterShader* FosterShaderCreateAsync_OpenGL(FosterShaderData* data)
+{
+	return FosterShaderSubmit_OpenGL(data, 1);
+}
+
+FosterBool FosterShaderIsReady_OpenGL(FosterShader* shader)
+{
+	FosterShader_OpenGL* it = (FosterShader_OpenGL*)shader;
+	if (it->reflected)
+		return 1;
+
+	// without parallel compilation there's no way to ask, so just wait for it
+	FosterProgramSubmit_OpenGL(it->program);
+	if (it->program->pending && fgl.parallelShaderCompile)
+	{
+		GLint complete = 0;
+		fgl.glGetProgramiv(it->program->id, GL_COMPLETION_STATUS_KHR, &complete);
+		if (!complete)
+			return 0;
+	}
+
+	FosterShaderFinish_OpenGL(it);
+	return 1;
+}
+
 void FosterShaderGetUniforms_OpenGL(FosterShader* shader, FosterUniformInfo* output, int* count, int max)
 {
 	FosterShader_OpenGL* it = (FosterShader_OpenGL*)shader;
+	FosterShaderFinish_OpenGL(it);
 
 	int t = 0;
 
@@ -1443,18 +3234,20 @@ void FosterShaderGetUniforms_OpenGL(FosterShader* shader, FosterUniformInfo* out
 
 		// OpenGL doesn't have separate Sampler's and Texture's...
 		// So we create an "extra" uniform and add a "_sampler" suffix
-		if (uniform->glType == GL_SAMPLER_2D)
+		if (FosterUniformIsTexture_OpenGL(uniform->glType))
 		{
 			output[t].index = i;
 			output[t].name = uniform->name;
-			output[t].type = FOSTER_UNIFORM_TYPE_TEXTURE2D;
+			output[t].type = uniform->glType == GL_SAMPLER_2D_ARRAY ? FOSTER_UNIFORM_TYPE_TEXTURE2D_ARRAY : FOSTER_UNIFORM_TYPE_TEXTURE2D;
 			output[t].arrayElements = uniform->glSize;
+			output[t].bufferIndex = -1;
 			t++;
 
 			output[t].index = i;
 			output[t].name = uniform->samplerName;
 			output[t].type = FOSTER_UNIFORM_TYPE_SAMPLER2D;
 			output[t].arrayElements = uniform->glSize;
+			output[t].bufferIndex = -1;
 			t++;
 		}
 		else
@@ -1463,6 +3256,7 @@ void FosterShaderGetUniforms_OpenGL(FosterShader* shader, FosterUniformInfo* out
 			output[t].name = uniform->name;
 			output[t].type = FosterUniformTypeFromGL(uniform->glType);
 			output[t].arrayElements = uniform->glSize;
+			output[t].bufferIndex = uniform->blockIndex;
 			t++;
 		}
 	}
@@ -1470,9 +3264,46 @@ void FosterShaderGetUniforms_OpenGL(FosterShader* shader, FosterUniformInfo* out
 	*count = t;
 }
 
+void FosterUniformBlockWrite_OpenGL(FosterUniformBlock_OpenGL* block, FosterUniform_OpenGL* uniform, float* values)
+{
+	// matrices are stored as columns, which are padded out in std140
+	int columns = 1;
+	int rows = FosterUniformComponentsFromGL(uniform->glType);
+	switch (uniform->glType)
+	{
+		case GL_FLOAT_MAT3x2: columns = 3; rows = 2; break;
+		case GL_FLOAT_MAT4: columns = 4; rows = 4; break;
+	}
+
+	if (rows <= 0)
+	{
+		FOSTER_LOG_ERROR("Failed to set uniform '%s', unsupported type '%i'", uniform->name, uniform->glType);
+		return;
+	}
+
+	size_t length = sizeof(float) * rows;
+	for (int i = 0; i < uniform->glSize; i++)
+	{
+		for (int c = 0; c < columns; c++, values += rows)
+		{
+			GLint offset = uniform->blockOffset + i * uniform->arrayStride + c * uniform->matrixStride;
+			if (offset < 0 || offset + (GLint)length > block->size)
+				return;
+
+			if (SDL_memcmp(block->data + offset, values, length) != 0)
+			{
+				SDL_memcpy(block->data + offset, values, length);
+				block->dirty = 1;
+			}
+		}
+	}
+}
+
 void FosterShaderSetUniform_OpenGL(FosterShader* shader, int index, float* values)
 {
 	FosterShader_OpenGL* it = (FosterShader_OpenGL*)shader;
+	FosterShaderFinish_OpenGL(it);
+	FosterShaderClaimProgram_OpenGL(it);
 
 	if (index < 0 || index > it->uniformCount)
 	{
@@ -1480,10 +3311,29 @@ void FosterShaderSetUniform_OpenGL(FosterShader* shader, int index, float* value
 		return;
 	}
 
-	FosterBindProgram(it->id);
-
 	FosterUniform_OpenGL* uniform = it->uniforms + index;
 
+	// block members are only written to the CPU copy, and uploaded when drawing
+	if (uniform->blockIndex >= 0)
+	{
+		FosterUniformBlockWrite_OpenGL(it->blocks + uniform->blockIndex, uniform, values);
+		return;
+	}
+
+	// skip the upload if it's the same as what the program already has
+	int components = FosterUniformComponentsFromGL(uniform->glType);
+	if (components > 0)
+	{
+		float* shadow = it->values + uniform->valueIndex;
+		size_t length = sizeof(float) * components * uniform->glSize;
+		if (uniform->valueSet && SDL_memcmp(shadow, values, length) == 0)
+			return;
+		SDL_memcpy(shadow, values, length);
+		uniform->valueSet = 1;
+	}
+
+	FosterBindProgram(it->id);
+
 	switch (uniform->glType)
 	{
 		case GL_FLOAT:
@@ -1512,6 +3362,7 @@ void FosterShaderSetUniform_OpenGL(FosterShader* shader, int index, float* value
 void FosterShaderSetTexture_OpenGL(FosterShader* shader, int index, FosterTexture** values)
 {
 	FosterShader_OpenGL* it = (FosterShader_OpenGL*)shader;
+	FosterShaderFinish_OpenGL(it);
 
 	if (index < 0 || index > it->uniformCount)
 	{
@@ -1520,7 +3371,7 @@ void FosterShaderSetTexture_OpenGL(FosterShader* shader, int index, FosterTextur
 	}
 
 	FosterUniform_OpenGL* uniform = it->uniforms + index;
-	if (uniform->glType != GL_SAMPLER_2D)
+	if (!FosterUniformIsTexture_OpenGL(uniform->glType))
 	{
 		FOSTER_LOG_ERROR("Failed to set uniform '%s': not a Texture", uniform->name);
 		return;
@@ -1529,6 +3380,8 @@ void FosterShaderSetTexture_OpenGL(FosterShader* shader, int index, FosterTextur
 	for (int i = 0; i < uniform->glSize && uniform->samplerIndex + i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
 	{
 		int index = uniform->samplerIndex + i;
+		if (it->textures[index] == (FosterTexture_OpenGL*)values[i])
+			continue;
 		FosterTextureReturnReference(it->textures[index]);
 		it->textures[index] = FosterTextureRequestReference((FosterTexture_OpenGL*)values[i]);
 	}
@@ -1537,6 +3390,7 @@ void FosterShaderSetTexture_OpenGL(FosterShader* shader, int index, FosterTextur
 void FosterShaderSetSampler_OpenGL(FosterShader* shader, int index, FosterTextureSampler* values)
 {
 	FosterShader_OpenGL* it = (FosterShader_OpenGL*)shader;
+	FosterShaderFinish_OpenGL(it);
 
 	if (index < 0 || index > it->uniformCount)
 	{
@@ -1545,7 +3399,7 @@ void FosterShaderSetSampler_OpenGL(FosterShader* shader, int index, FosterTextur
 	}
 
 	FosterUniform_OpenGL* uniform = it->uniforms + index;
-	if (uniform->glType != GL_SAMPLER_2D)
+	if (!FosterUniformIsTexture_OpenGL(uniform->glType))
 	{
 		FOSTER_LOG_ERROR("Failed to set uniform '%s': not a Sampler", uniform->name);
 		return;
@@ -1558,43 +3412,209 @@ void FosterShaderSetSampler_OpenGL(FosterShader* shader, int index, FosterTextur
 void FosterShaderDestroy_OpenGL(FosterShader* shader)
 {
 	FosterShader_OpenGL* it = (FosterShader_OpenGL*)shader;
-	fgl.glDeleteProgram(it->id);
+	if (it->program->owner == it)
+		it->program->owner = NULL;
+	FosterProgramRelease_OpenGL(it->program);
+
+	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+		FosterTextureReturnReference(it->textures[i]);
+
+	for (int i = 0; i < it->uniformCount; i++)
+	{
+		SDL_free(it->uniforms[i].name);
+		SDL_free(it->uniforms[i].samplerName);
+	}
+
+	for (int i = 0; i < it->blockCount; i++)
+		SDL_free(it->blocks[i].data);
+
+	SDL_free(it->uniforms);
+	SDL_free(it->blocks);
+	SDL_free(it->values);
+	SDL_free(it);
+}
+
+FosterPipeline* FosterPipelineCreate_OpenGL(FosterPipelineDesc* desc)
+{
+	FosterPipeline_OpenGL* pipeline = (FosterPipeline_OpenGL*)SDL_malloc(sizeof(FosterPipeline_OpenGL));
+	FosterBlend* blend = &desc->blend;
+	pipeline->desc = *desc;
+	pipeline->blendEquation[0] = FosterBlendOpToGL(blend->colorOp);
+	pipeline->blendEquation[1] = FosterBlendOpToGL(blend->alphaOp);
+	pipeline->blendFunc[0] = FosterBlendFactorToGL(blend->colorSrc);
+	pipeline->blendFunc[1] = FosterBlendFactorToGL(blend->colorDst);
+	pipeline->blendFunc[2] = FosterBlendFactorToGL(blend->alphaSrc);
+	pipeline->blendFunc[3] = FosterBlendFactorToGL(blend->alphaDst);
+	pipeline->colorMask[0] = ((int)blend->mask & (int)FOSTER_BLEND_MASK_R) != 0;
+	pipeline->colorMask[1] = ((int)blend->mask & (int)FOSTER_BLEND_MASK_G) != 0;
+	pipeline->colorMask[2] = ((int)blend->mask & (int)FOSTER_BLEND_MASK_B) != 0;
+	pipeline->colorMask[3] = ((int)blend->mask & (int)FOSTER_BLEND_MASK_A) != 0;
+	pipeline->blendColor[0] = (unsigned char)(blend->rgba >> 24) / 255.0f;
+	pipeline->blendColor[1] = (unsigned char)(blend->rgba >> 16) / 255.0f;
+	pipeline->blendColor[2] = (unsigned char)(blend->rgba >> 8) / 255.0f;
+	pipeline->blendColor[3] = (unsigned char)(blend->rgba) / 255.0f;
+	pipeline->depthFunc = FosterCompareToGL(desc->compare);
+	pipeline->depthMask = desc->depthMask ? 1 : 0;
+	pipeline->cullFace = FosterCullToGL(desc->cull);
+	return (FosterPipeline*)pipeline;
+}
+
+void FosterPipelineDestroy_OpenGL(FosterPipeline* pipeline)
+{
+	// a new pipeline could be allocated at the same address
+	if (fgl.statePipeline == (FosterPipeline_OpenGL*)pipeline)
+		fgl.statePipeline = NULL;
+	SDL_free(pipeline);
+}
+
+FosterMesh* FosterMeshCreate_OpenGL(FosterMeshUsage usage)
+{
+	FosterMesh_OpenGL result;
+	result.id = 0;
+	result.indexBuffer = 0;
+	result.vertexBuffer = 0;
+	result.instanceBuffer = 0;
+	result.vertexAttributesEnabled = 0;
+	result.instanceAttributesEnabled = 0;
+	result.vertexBufferSize = 0;
+	result.indexBufferSize = 0;
+	result.instanceBufferSize = 0;
+	result.vertexBufferUsed = 0;
+	result.indexBufferUsed = 0;
+	result.instanceBufferUsed = 0;
+	result.usage = usage;
+	result.vertexFormat.elements = NULL;
+	result.vertexFormat.elementCount = 0;
+	result.vertexFormat.stride = 0;
+	result.instanceFormat = result.vertexFormat;
+	result.transientId = 0;
+	result.transientGeneration = 0;
+	result.transientVertexOffset = 0;
+	result.vertexOffset = 0;
+	result.instanceOffset = 0;
+	result.transientInstanceOffset = 0;
+
+	fgl.glGenVertexArrays(1, &result.id);
+	if (result.id == 0)
+	{
+		FOSTER_LOG_ERROR("%s", "Failed to create Mesh");
+		return NULL;
+	}
+
+	FosterMesh_OpenGL* mesh = (FosterMesh_OpenGL*)SDL_malloc(sizeof(FosterMesh_OpenGL));
+	*mesh = result;
+	mesh->vertexFormat.elements = mesh->vertexFormatElements;
+	mesh->instanceFormat.elements = mesh->instanceFormatElements;
+	return (FosterMesh*)mesh;
+}
+
+GLenum FosterMeshUsageToGL(FosterMeshUsage usage)
+{
+	switch (usage)
+	{
+		case FOSTER_MESH_USAGE_STATIC: return GL_STATIC_DRAW;
+		case FOSTER_MESH_USAGE_DYNAMIC: return GL_DYNAMIC_DRAW;
+		case FOSTER_MESH_USAGE_STREAM: return GL_STREAM_DRAW;
+		default: return GL_DYNAMIC_DRAW;
+	}
+}
+
+void FosterDeleteBuffer_OpenGL(GLuint buffer)
+{
+	// the name may be reused by the next buffer created
+	if (fgl.stateArrayBuffer == buffer)
+		fgl.stateArrayBuffer = 0;
+	if (fgl.stateElementBuffer == buffer)
+		fgl.stateElementBuffer = 0;
+	fgl.glDeleteBuffers(1, &buffer);
+}
+
+// Writes data into one of the Mesh's buffers, allocating storage to suit the Mesh's usage.
+// Static meshes get immutable storage of the exact size, which is replaced if it has to grow.
+// Dynamic and Stream meshes grow geometrically, and are orphaned when all of their data is rewritten.
+// Returns true if the buffer was replaced, in which case it has to be attached to the vertex array.
+bool FosterMeshWriteBuffer_OpenGL(FosterMesh_OpenGL* mesh, GLuint* buffer, int* capacity, int* used, void* data, int dataSize, int dataDestOffset)
+{
+	int totalSize = dataDestOffset + dataSize;
+	int immutable = mesh->usage == FOSTER_MESH_USAGE_STATIC && fgl.bufferStorage;
+	bool replaced = false;
+
+	if (data != NULL)
+		fgl.stats.bufferUploadBytes += dataSize;
+
+	// all writes go through the copy target, so no vertex array bindings are disturbed
+	if (*buffer == 0 || totalSize > *capacity)
+	{
+		int newCapacity = totalSize;
+		if (mesh->usage != FOSTER_MESH_USAGE_STATIC && *capacity * 2 > newCapacity)
+			newCapacity = *capacity * 2;
+
+		// anything before the written range has to be kept, which needs a new buffer to copy into
+		if (*buffer == 0 || immutable || dataDestOffset > 0)
+		{
+			GLuint previous = *buffer;
+			fgl.glGenBuffers(1, buffer);
+			fgl.glBindBuffer(GL_COPY_WRITE_BUFFER, *buffer);
+
+			if (immutable && dataDestOffset == 0 && data != NULL)
+			{
+				fgl.glBufferStorage(GL_COPY_WRITE_BUFFER, newCapacity, data, GL_DYNAMIC_STORAGE_BIT);
+				data = NULL;
+			}
+			else if (immutable)
+				fgl.glBufferStorage(GL_COPY_WRITE_BUFFER, newCapacity, NULL, GL_DYNAMIC_STORAGE_BIT);
+			else
+				fgl.glBufferData(GL_COPY_WRITE_BUFFER, newCapacity, NULL, FosterMeshUsageToGL(mesh->usage));
+
+			if (previous != 0)
+			{
+				int preserve = SDL_min(dataDestOffset, *capacity);
+				if (preserve > 0)
+				{
+					fgl.glBindBuffer(GL_COPY_READ_BUFFER, previous);
+					fgl.glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, preserve);
+				}
+				FosterDeleteBuffer_OpenGL(previous);
+			}
 
-	for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
-		FosterTextureReturnReference(it->textures[i]);
+			replaced = true;
+		}
+		else
+		{
+			fgl.glBindBuffer(GL_COPY_WRITE_BUFFER, *buffer);
+			fgl.glBufferData(GL_COPY_WRITE_BUFFER, newCapacity, NULL, FosterMeshUsageToGL(mesh->usage));
+		}
 
-	for (int i = 0; i < it->uniformCount; i++)
+		*capacity = newCapacity;
+	}
+	else
 	{
-		SDL_free(it->uniforms[i].name);
-		SDL_free(it->uniforms[i].samplerName);
+		fgl.glBindBuffer(GL_COPY_WRITE_BUFFER, *buffer);
+
+		// orphan the buffer when all of its data is rewritten, so the upload doesn't wait on
+		// draws using the previous data. partial writes have to keep the rest of the data.
+		if (mesh->usage != FOSTER_MESH_USAGE_STATIC && dataDestOffset == 0 && dataSize >= *used)
+		{
+			fgl.glBufferData(GL_COPY_WRITE_BUFFER, *capacity, NULL, FosterMeshUsageToGL(mesh->usage));
+			*used = 0;
+		}
 	}
 
-	SDL_free(it->uniforms);
-	SDL_free(it);
-}
+	if (totalSize > *used)
+		*used = totalSize;
 
-FosterMesh* FosterMeshCreate_OpenGL()
-{
-	FosterMesh_OpenGL result;
-	result.id = 0;
-	result.indexBuffer = 0;
-	result.vertexBuffer = 0;
-	result.instanceBuffer = 0;
-	result.vertexAttributesEnabled = 0;
-	result.instanceAttributesEnabled = 0;
-	result.vertexBufferSize = 0;
-	result.indexBufferSize = 0;
+	// fill data at the offset
+	if (data != NULL && dataSize > 0)
+		fgl.glBufferSubData(GL_COPY_WRITE_BUFFER, dataDestOffset, dataSize, data);
 
-	fgl.glGenVertexArrays(1, &result.id);
-	if (result.id == 0)
-	{
-		FOSTER_LOG_ERROR("%s", "Failed to create Mesh");
-		return NULL;
-	}
+	return replaced;
+}
 
-	FosterMesh_OpenGL* mesh = (FosterMesh_OpenGL*)SDL_malloc(sizeof(FosterMesh_OpenGL));
-	*mesh = result;
-	return (FosterMesh*)mesh;
+void FosterMeshCopyFormat_OpenGL(FosterVertexFormat* dst, FosterVertexFormat* src)
+{
+	dst->elementCount = SDL_min(src->elementCount, FOSTER_MAX_VERTEX_FORMAT_ELEMENTS);
+	dst->stride = src->stride;
+	SDL_memcpy(dst->elements, src->elements, sizeof(FosterVertexFormatElement) * dst->elementCount);
 }
 
 void FosterMeshSetVertexFormat_OpenGL(FosterMesh* mesh, FosterVertexFormat* format)
@@ -1604,36 +3624,27 @@ void FosterMeshSetVertexFormat_OpenGL(FosterMesh* mesh, FosterVertexFormat* form
 
 	if (it->vertexBuffer == 0)
 		fgl.glGenBuffers(1, &(it->vertexBuffer));
-	FosterMeshAssignAttributes_OpenGL(it->vertexBuffer, GL_ARRAY_BUFFER, format, 0);
+	FosterMeshAssignAttributes_OpenGL(it->vertexBuffer, GL_ARRAY_BUFFER, format, 0, 0);
+	it->vertexOffset = 0;
+
+	// keep a copy for when the buffers change, and for the transient vertex array,
+	// which is re-pointed on its next use
+	FosterMeshCopyFormat_OpenGL(&it->vertexFormat, format);
+	it->transientGeneration = 0;
 }
 
 void FosterMeshSetVertexData_OpenGL(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
 {
 	FosterMesh_OpenGL* it = (FosterMesh_OpenGL*)mesh;
-	FosterBindArray(it->id);
-
-	if (it->vertexBuffer == 0)
-	{
-		fgl.glGenBuffers(1, &(it->vertexBuffer));
-		fgl.glBindBuffer(GL_ARRAY_BUFFER, it->vertexBuffer);
-		fgl.stateArrayBuffer = it->vertexBuffer;
-	}
-	else if (fgl.stateArrayBuffer != it->vertexBuffer)
-	{
-		fgl.glBindBuffer(GL_ARRAY_BUFFER, it->vertexBuffer);
-		fgl.stateArrayBuffer = it->vertexBuffer;
-	}
 
-	// expand vertex buffer if needed
-	int totalSize = dataDestOffset + dataSize;
-	if (totalSize > it->vertexBufferSize)
+	// a new buffer has to be attached to the vertex array
+	if (FosterMeshWriteBuffer_OpenGL(it, &it->vertexBuffer, &it->vertexBufferSize, &it->vertexBufferUsed, data, dataSize, dataDestOffset) &&
+		it->vertexFormat.elementCount > 0)
 	{
-		it->vertexBufferSize = totalSize;
-		fgl.glBufferData(GL_ARRAY_BUFFER, totalSize, NULL, GL_DYNAMIC_DRAW);
+		FosterBindArray(it->id);
+		FosterMeshAssignAttributes_OpenGL(it->vertexBuffer, GL_ARRAY_BUFFER, &it->vertexFormat, 0, 0);
+		it->vertexOffset = 0;
 	}
-
-	// fill data at the offset
-	fgl.glBufferSubData(GL_ARRAY_BUFFER, dataDestOffset, dataSize, data);
 }
 
 void FosterMeshSetIndexFormat_OpenGL(FosterMesh* mesh, FosterIndexFormat format)
@@ -1659,29 +3670,43 @@ void FosterMeshSetIndexFormat_OpenGL(FosterMesh* mesh, FosterIndexFormat format)
 void FosterMeshSetIndexData_OpenGL(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
 {
 	FosterMesh_OpenGL* it = (FosterMesh_OpenGL*)mesh;
-	FosterBindArray(it->id);
 
-	if (it->indexBuffer == 0)
-	{
-		fgl.glGenBuffers(1, &(it->indexBuffer));
-		fgl.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, it->indexBuffer);
-		fgl.stateElementBuffer = it->indexBuffer;
-	}
-	else if (fgl.stateElementBuffer != it->indexBuffer)
+	// a new buffer has to be attached to the vertex array
+	if (FosterMeshWriteBuffer_OpenGL(it, &it->indexBuffer, &it->indexBufferSize, &it->indexBufferUsed, data, dataSize, dataDestOffset))
 	{
+		FosterBindArray(it->id);
 		fgl.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, it->indexBuffer);
 		fgl.stateElementBuffer = it->indexBuffer;
 	}
-	// expand buffer if needed
-	int totalSize = dataDestOffset + dataSize;
-	if (totalSize > it->indexBufferSize)
+}
+
+void FosterMeshSetInstanceFormat_OpenGL(FosterMesh* mesh, FosterVertexFormat* format)
+{
+	FosterMesh_OpenGL* it = (FosterMesh_OpenGL*)mesh;
+	FosterBindArray(it->id);
+
+	if (it->instanceBuffer == 0)
+		fgl.glGenBuffers(1, &(it->instanceBuffer));
+	FosterMeshAssignAttributes_OpenGL(it->instanceBuffer, GL_ARRAY_BUFFER, format, 1, 0);
+	it->instanceOffset = 0;
+
+	FosterMeshCopyFormat_OpenGL(&it->instanceFormat, format);
+	it->transientGeneration = 0;
+}
+
+void FosterMeshSetInstanceData_OpenGL(FosterMesh* mesh, void* data, int dataSize, int dataDestOffset)
+{
+	FosterMesh_OpenGL* it = (FosterMesh_OpenGL*)mesh;
+
+	// a new buffer has to be attached to both vertex arrays
+	if (FosterMeshWriteBuffer_OpenGL(it, &it->instanceBuffer, &it->instanceBufferSize, &it->instanceBufferUsed, data, dataSize, dataDestOffset) &&
+		it->instanceFormat.elementCount > 0)
 	{
-		it->indexBufferSize = totalSize;
-		fgl.glBufferData(GL_ELEMENT_ARRAY_BUFFER, totalSize, NULL, GL_DYNAMIC_DRAW);
+		FosterBindArray(it->id);
+		FosterMeshAssignAttributes_OpenGL(it->instanceBuffer, GL_ARRAY_BUFFER, &it->instanceFormat, 1, 0);
+		it->instanceOffset = 0;
+		it->transientGeneration = 0;
 	}
-
-	// fill data from the offset
-	fgl.glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, dataDestOffset, dataSize, data);
 }
 
 void FosterMeshDestroy_OpenGL(FosterMesh* mesh)
@@ -1689,62 +3714,368 @@ void FosterMeshDestroy_OpenGL(FosterMesh* mesh)
 	FosterMesh_OpenGL* it = (FosterMesh_OpenGL*)mesh;
 
 	if (it->vertexBuffer != 0)
-		fgl.glDeleteBuffers(1, &it->vertexBuffer);
+		FosterDeleteBuffer_OpenGL(it->vertexBuffer);
 	if (it->indexBuffer != 0)
-		fgl.glDeleteBuffers(1, &it->indexBuffer);
+		FosterDeleteBuffer_OpenGL(it->indexBuffer);
 	if (it->instanceBuffer != 0)
-		fgl.glDeleteBuffers(1, &it->instanceBuffer);
+		FosterDeleteBuffer_OpenGL(it->instanceBuffer);
 	if (it->id != 0)
 		fgl.glDeleteVertexArrays(1, &it->id);
+	if (it->transientId != 0)
+		fgl.glDeleteVertexArrays(1, &it->transientId);
 
 	SDL_free(it);
 }
 
-void FosterDraw_OpenGL(FosterDrawCommand* command)
+void* FosterTransientAllocVertices_OpenGL(int dataSize, int* offset)
+{
+	void* result = FosterTransientRingAlloc_OpenGL(&fgl.transientVertices, dataSize, offset);
+	if (result != NULL)
+		fgl.stats.bufferUploadBytes += dataSize;
+	return result;
+}
+
+void* FosterTransientAllocIndices_OpenGL(int dataSize, int* offset)
+{
+	void* result = FosterTransientRingAlloc_OpenGL(&fgl.transientIndices, dataSize, offset);
+	if (result != NULL)
+		fgl.stats.bufferUploadBytes += dataSize;
+	return result;
+}
+
+FosterBool FosterTransientAllocGeometry_OpenGL(int vertexSize, int indexSize, void** vertices, void** indices, int* vertexOffset, int* indexOffset)
+{
+	// both rings are checked first, so neither is left with a range that's never drawn
+	int vertexFits = FosterTransientRingFits_OpenGL(&fgl.transientVertices, vertexSize);
+	int indexFits = FosterTransientRingFits_OpenGL(&fgl.transientIndices, indexSize);
+	if (!vertexFits || !indexFits)
+		return 0;
+
+	*vertices = FosterTransientAllocVertices_OpenGL(vertexSize, vertexOffset);
+	*indices = FosterTransientAllocIndices_OpenGL(indexSize, indexOffset);
+	return 1;
+}
+
+void FosterShaderApplyUniforms_OpenGL(FosterShader* shaderPtr, float* values, FosterTextureSampler* samplers, FosterTexture** textures)
+{
+	FosterShader_OpenGL* shader = (FosterShader_OpenGL*)shaderPtr;
+	FosterShaderFinish_OpenGL(shader);
+
+	for (int i = 0; i < shader->uniformCount; i++)
+	{
+		FosterUniform_OpenGL* uniform = shader->uniforms + i;
+
+		if (FosterUniformIsTexture_OpenGL(uniform->glType))
+		{
+			if (textures != NULL)
+				FosterShaderSetTexture_OpenGL((FosterShader*)shader, i, textures + uniform->samplerIndex);
+			if (samplers != NULL)
+				FosterShaderSetSampler_OpenGL((FosterShader*)shader, i, samplers + uniform->samplerIndex);
+		}
+		else if (values != NULL && FosterUniformComponentsFromGL(uniform->glType) > 0)
+		{
+			FosterShaderSetUniform_OpenGL((FosterShader*)shader, i, values + uniform->valueIndex);
+		}
+	}
+}
+
+void FosterShaderBindUniformBlocks_OpenGL(FosterShader_OpenGL* shader)
+{
+	GLsizeiptr total = 0;
+	int upload = 0;
+	for (int i = 0; i < shader->blockCount; i++)
+	{
+		FosterUniformBlock_OpenGL* block = shader->blocks + i;
+		upload |= block->dirty || block->ringGeneration != fgl.uniformRingGeneration;
+		total += block->size + fgl.uniform_buffer_offset_alignment;
+	}
+
+	// reserve room for all the blocks at once, as orphaning the ring would
+	// throw away any blocks that were already written for this draw
+	if (upload)
+		FosterUniformRingReserve_OpenGL(total);
+
+	for (int i = 0; i < shader->blockCount; i++)
+	{
+		FosterUniformBlock_OpenGL* block = shader->blocks + i;
+
+		if (block->dirty || block->ringGeneration != fgl.uniformRingGeneration)
+		{
+			block->ringOffset = FosterUniformRingWrite_OpenGL(block->data, block->size);
+			block->ringGeneration = fgl.uniformRingGeneration;
+			block->dirty = 0;
+		}
+
+		FosterBindUniformBlock(i, block->ringOffset, block->size);
+	}
+}
+
+bool FosterDrawStateEqual_OpenGL(const FosterDrawCommand* a, const FosterDrawCommand* b)
+{
+	return
+		a->target == b->target &&
+		a->shader == b->shader &&
+		a->mesh == b->mesh &&
+		a->hasViewport == b->hasViewport &&
+		(!a->hasViewport || FOSTER_RECT_EQUAL(a->viewport, b->viewport)) &&
+		a->hasScissor == b->hasScissor &&
+		(!a->hasScissor || FOSTER_RECT_EQUAL(a->scissor, b->scissor)) &&
+		a->transient == b->transient &&
+		a->pipeline == b->pipeline &&
+		(a->pipeline != NULL || (
+			a->compare == b->compare &&
+			a->depthMask == b->depthMask &&
+			a->cull == b->cull &&
+			SDL_memcmp(&a->blend, &b->blend, sizeof(FosterBlend)) == 0));
+}
+
+void FosterDrawApplyState_OpenGL(FosterDrawCommand* command)
 {
 	FosterTarget_OpenGL* target = (FosterTarget_OpenGL*)command->target;
 	FosterShader_OpenGL* shader = (FosterShader_OpenGL*)command->shader;
 	FosterMesh_OpenGL* mesh = (FosterMesh_OpenGL*)command->mesh;
 
-	// Set State
+	FosterShaderFinish_OpenGL(shader);
 	FosterBindFrameBuffer(target);
 	FosterBindProgram(shader->id);
-	FosterBindArray(mesh->id);
-	FosterSetBlend(&command->blend);
-	FosterSetCompare(command->compare);
-	FosterSetDepthMask(command->depthMask);
-	FosterSetCull(command->cull);
+	if (command->transient)
+	{
+		if (mesh->transientId == 0)
+			fgl.glGenVertexArrays(1, &mesh->transientId);
+		FosterBindArray(mesh->transientId);
+	}
+	else
+	{
+		FosterBindArray(mesh->id);
+	}
+	if (command->pipeline != NULL)
+	{
+		FosterSetPipeline((FosterPipeline_OpenGL*)command->pipeline);
+	}
+	else
+	{
+		FosterSetBlend(&command->blend);
+		FosterSetCompare(command->compare);
+		FosterSetDepthMask(command->depthMask);
+		FosterSetCull(command->cull);
+	}
 	FosterSetViewport(command->hasViewport, command->viewport);
 	FosterSetScissor(command->hasScissor, command->scissor);
+}
 
-	// Update Texture Uniforms & Samplers
+// Points the Mesh's transient vertex array at where the command's data is in the transient rings
+void FosterMeshBindTransient_OpenGL(FosterMesh_OpenGL* mesh)
+{
+	FosterTransientRingUpload_OpenGL(&fgl.transientVertices);
+	FosterTransientRingUpload_OpenGL(&fgl.transientIndices);
+
+	// the element buffer binding is part of the vertex array's state,
+	// and instances are always drawn from the Mesh's own instance buffer
+	if (mesh->transientGeneration != fgl.transientGeneration)
 	{
-		GLuint textureSlots[FOSTER_MAX_UNIFORM_TEXTURES];
+		fgl.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, fgl.transientIndices.buffer);
+		fgl.stateElementBuffer = fgl.transientIndices.buffer;
+
+		if (mesh->instanceFormat.elementCount > 0 && mesh->instanceBuffer != 0)
+			FosterMeshAssignAttributes_OpenGL(mesh->instanceBuffer, GL_ARRAY_BUFFER, &mesh->instanceFormat, 1, 0);
+		mesh->transientInstanceOffset = 0;
+		mesh->transientVertexOffset = -1;
+		mesh->transientGeneration = fgl.transientGeneration;
+	}
+}
+
+// Points the vertex attributes at the given byte offset from the command's first vertex
+void FosterMeshBindVertices_OpenGL(FosterMesh_OpenGL* mesh, FosterDrawCommand* command, GLintptr offset)
+{
+	GLintptr* current = command->transient ? &mesh->transientVertexOffset : &mesh->vertexOffset;
+	GLuint buffer = command->transient ? fgl.transientVertices.buffer : mesh->vertexBuffer;
+
+	if (command->transient)
+		offset += command->transientVertexOffset;
 
-		// update samplers
-		for (int i = 0; i < FOSTER_MAX_UNIFORM_TEXTURES; i++)
+	if (*current != offset && mesh->vertexFormat.elementCount > 0)
+	{
+		FosterMeshAssignAttributes_OpenGL(buffer, GL_ARRAY_BUFFER, &mesh->vertexFormat, 0, offset);
+		*current = offset;
+	}
+}
+
+// Points the instance attributes at the command's first instance, as there's no base instance in GL 3.3
+void FosterMeshBindInstances_OpenGL(FosterMesh_OpenGL* mesh, FosterDrawCommand* command)
+{
+	GLintptr offset = (GLintptr)command->instanceStart * mesh->instanceFormat.stride;
+	GLintptr* current = command->transient ? &mesh->transientInstanceOffset : &mesh->instanceOffset;
+
+	if (*current != offset)
+	{
+		FosterMeshAssignAttributes_OpenGL(mesh->instanceBuffer, GL_ARRAY_BUFFER, &mesh->instanceFormat, 1, offset);
+		*current = offset;
+	}
+}
+
+// Draws a single range of the Mesh's indices
+void FosterDrawElements_OpenGL(FosterMesh_OpenGL* mesh, FosterDrawCommand* command, int indexStart, int indexCount, int baseVertex)
+{
+	int64_t indexStartPtr = (int64_t)mesh->indexSize * indexStart;
+	if (command->transient)
+		indexStartPtr += command->transientIndexOffset;
+
+	// without base vertex support, the vertex attributes are offset instead
+	if (fgl.baseVertex)
+	{
+		FosterMeshBindVertices_OpenGL(mesh, command, 0);
+	}
+	else
+	{
+		FosterMeshBindVertices_OpenGL(mesh, command, (GLintptr)baseVertex * mesh->vertexFormat.stride);
+		baseVertex = 0;
+	}
+
+	if (command->instanceCount > 0)
+	{
+		if (baseVertex != 0)
+		{
+			fgl.glDrawElementsInstancedBaseVertex(
+				GL_TRIANGLES,
+				(GLint)indexCount,
+				mesh->indexFormat,
+				(void*)indexStartPtr,
+				(GLint)command->instanceCount,
+				(GLint)baseVertex);
+		}
+		else
+		{
+			fgl.glDrawElementsInstanced(
+				GL_TRIANGLES,
+				(GLint)indexCount,
+				mesh->indexFormat,
+				(void*)indexStartPtr,
+				(GLint)command->instanceCount);
+		}
+	}
+	else
+	{
+		if (baseVertex != 0)
+		{
+			fgl.glDrawElementsBaseVertex(
+				GL_TRIANGLES,
+				(GLint)indexCount,
+				mesh->indexFormat,
+				(void*)indexStartPtr,
+				(GLint)baseVertex);
+		}
+		else
+		{
+			fgl.glDrawElements(
+				GL_TRIANGLES,
+				(GLint)indexCount,
+				mesh->indexFormat,
+				(void*)indexStartPtr);
+		}
+	}
+
+	fgl.stats.drawCalls++;
+	fgl.stats.triangles += indexCount / 3 * SDL_max(command->instanceCount, 1);
+}
+
+// Draws all of the command's ranges, in a single call if the driver can
+void FosterDrawRanges_OpenGL(FosterMesh_OpenGL* mesh, FosterDrawCommand* command)
+{
+	// there's no instanced multi-draw, so those are drawn one range at a time
+	if (!fgl.baseVertex || fgl.glMultiDrawElementsBaseVertex == NULL || command->instanceCount > 0)
+	{
+		for (int i = 0; i < command->rangeCount; i++)
 		{
-			FosterTexture_OpenGL* tex = shader->textures[i];
-			if (shader->textures[i] != NULL)
-				FosterSetTextureSampler(shader->textures[i], shader->samplers[i]);
+			FosterDrawRange* range = &command->ranges[i];
+			FosterDrawElements_OpenGL(mesh, command, range->indexStart, range->indexCount, range->baseVertex);
 		}
+		return;
+	}
+
+	if (command->rangeCount > fgl.multiDrawCapacity)
+	{
+		int capacity = SDL_max(command->rangeCount, fgl.multiDrawCapacity * 2);
+		fgl.multiDrawCounts = (GLint*)SDL_realloc(fgl.multiDrawCounts, sizeof(GLint) * capacity);
+		fgl.multiDrawIndices = (void**)SDL_realloc(fgl.multiDrawIndices, sizeof(void*) * capacity);
+		fgl.multiDrawBaseVertices = (GLint*)SDL_realloc(fgl.multiDrawBaseVertices, sizeof(GLint) * capacity);
+		fgl.multiDrawCapacity = capacity;
+	}
+
+	int64_t indexOffset = command->transient ? command->transientIndexOffset : 0;
+	for (int i = 0; i < command->rangeCount; i++)
+	{
+		FosterDrawRange* range = &command->ranges[i];
+		fgl.multiDrawCounts[i] = (GLint)range->indexCount;
+		fgl.multiDrawIndices[i] = (void*)(indexOffset + (int64_t)mesh->indexSize * range->indexStart);
+		fgl.multiDrawBaseVertices[i] = (GLint)range->baseVertex;
+		fgl.stats.triangles += range->indexCount / 3;
+	}
+
+	FosterMeshBindVertices_OpenGL(mesh, command, 0);
+	fgl.glMultiDrawElementsBaseVertex(
+		GL_TRIANGLES,
+		fgl.multiDrawCounts,
+		mesh->indexFormat,
+		fgl.multiDrawIndices,
+		(GLint)command->rangeCount,
+		fgl.multiDrawBaseVertices);
+	fgl.stats.drawCalls++;
+}
+
+void FosterDrawMesh_OpenGL(FosterDrawCommand* command)
+{
+	FosterShader_OpenGL* shader = (FosterShader_OpenGL*)command->shader;
+	FosterMesh_OpenGL* mesh = (FosterMesh_OpenGL*)command->mesh;
+	fgl.stats.drawCommands++;
+
+	// shaders that failed to compile draw nothing
+	if (shader->id == 0)
+		return;
+
+	// another shader sharing the program may have replaced its uniforms
+	FosterShaderClaimProgram_OpenGL(shader);
+
+	// Apply Uniform values that were submitted with the command, unless
+	// the previous draw with this shader already applied the exact same ones
+	if ((command->uniformValues != NULL || command->uniformSamplers != NULL || command->uniformTextures != NULL) && (
+		shader->appliedSubmit != fgl.submitCount ||
+		shader->appliedValues != command->uniformValues ||
+		shader->appliedSamplers != command->uniformSamplers ||
+		shader->appliedTextures != command->uniformTextures))
+	{
+		FosterShaderApplyUniforms_OpenGL((FosterShader*)shader, command->uniformValues, command->uniformSamplers, command->uniformTextures);
+		shader->appliedSubmit = fgl.submitCount;
+		shader->appliedValues = command->uniformValues;
+		shader->appliedSamplers = command->uniformSamplers;
+		shader->appliedTextures = command->uniformTextures;
+	}
+
+	// Upload & bind Uniform Blocks
+	if (shader->blockCount > 0)
+		FosterShaderBindUniformBlocks_OpenGL(shader);
+
+	// Update Texture Uniforms & Samplers
+	{
+		GLuint textureSlots[FOSTER_MAX_UNIFORM_TEXTURES];
 
 		// bind textures
 		int slot = 0;
 		for (int i = 0; i < shader->uniformCount; i++)
 		{
 			FosterUniform_OpenGL* uniform = shader->uniforms + i;
-			if (uniform->glType != GL_SAMPLER_2D)
+			if (!FosterUniformIsTexture_OpenGL(uniform->glType))
 				continue;
 
-			// bind textures & update sampler state
+			// bind textures & sampler objects
+			int changed = 0;
 			for (int n = 0; n < uniform->glSize && slot < FOSTER_MAX_UNIFORM_TEXTURES; n++)
 			{
 				FosterTexture_OpenGL* tex = shader->textures[uniform->samplerIndex + n];
 
 				if (tex != NULL && !tex->disposed)
 				{
-					FosterEnsureTextureSlotIs(slot, tex->id);
+					FosterEnsureTextureSlotIs(slot, tex->glTarget, tex->id);
+					FosterBindSampler(slot, FosterGetSampler_OpenGL(shader->samplers[uniform->samplerIndex + n]));
 					textureSlots[n] = slot;
 					slot++;
 				}
@@ -1752,40 +4083,98 @@ void FosterDraw_OpenGL(FosterDrawCommand* command)
 				{
 					textureSlots[n] = 0;
 				}
+
+				if (uniform->samplerIndex + n < FOSTER_MAX_UNIFORM_TEXTURES &&
+					shader->textureSlots[uniform->samplerIndex + n] != (GLint)textureSlots[n])
+				{
+					shader->textureSlots[uniform->samplerIndex + n] = (GLint)textureSlots[n];
+					changed = 1;
+				}
 			}
 
-			// bind texture slots for this uniform
-			fgl.glUniform1iv(uniform->glLocation, (GLint)uniform->glSize, textureSlots);
+			// bind texture slots for this uniform, if they've changed
+			if (changed)
+				fgl.glUniform1iv(uniform->glLocation, (GLint)uniform->glSize, textureSlots);
 		}
 	}
 
+	// Point the transient vertex array at this draw's data
+	if (command->transient)
+		FosterMeshBindTransient_OpenGL(mesh);
+	if (command->instanceCount > 0 && mesh->instanceFormat.elementCount > 0)
+		FosterMeshBindInstances_OpenGL(mesh, command);
+
 	// Draw the Mesh
-	{
-		int64_t indexStartPtr = mesh->indexSize * command->indexStart;
+	if (command->rangeCount > 0 && command->ranges != NULL)
+		FosterDrawRanges_OpenGL(mesh, command);
+	else
+		FosterDrawElements_OpenGL(mesh, command, command->indexStart, command->indexCount, command->baseVertex);
+}
 
-		if (command->instanceCount > 0)
-		{
-			fgl.glDrawElementsInstanced(
-				GL_TRIANGLES,
-				(GLint)(command->indexCount),
-				mesh->indexFormat,
-				(void*)indexStartPtr,
-				(GLint)command->instanceCount);
-		}
-		else
+void FosterDraw_OpenGL(FosterDrawCommand* command)
+{
+	fgl.submitCount++;
+	FosterDrawApplyState_OpenGL(command);
+	FosterDrawMesh_OpenGL(command);
+}
+
+// Tells the driver the contents of the bound framebuffer's buffers aren't needed anymore
+void FosterInvalidate_OpenGL(FosterTarget_OpenGL* target, FosterClearMask mask)
+{
+	GLenum attachments[FOSTER_MAX_TARGET_ATTACHMENTS + 2];
+	int count = 0;
+
+	if (!fgl.invalidateFramebuffer || mask == FOSTER_CLEAR_MASK_NONE)
+		return;
+
+	int color = (mask & FOSTER_CLEAR_MASK_COLOR) == FOSTER_CLEAR_MASK_COLOR;
+	int depth = (mask & FOSTER_CLEAR_MASK_DEPTH) == FOSTER_CLEAR_MASK_DEPTH;
+	int stencil = (mask & FOSTER_CLEAR_MASK_STENCIL) == FOSTER_CLEAR_MASK_STENCIL;
+
+	// the default framebuffer names its buffers instead of its attachments
+	if (target == NULL)
+	{
+		if (color) attachments[count++] = GL_COLOR;
+		if (depth) attachments[count++] = GL_DEPTH;
+		if (stencil) attachments[count++] = GL_STENCIL;
+	}
+	else
+	{
+		for (int i = 0; i < target->attachmentCount; i++)
 		{
-			fgl.glDrawElements(
-				GL_TRIANGLES,
-				(GLint)(command->indexCount),
-				mesh->indexFormat,
-				(void*)indexStartPtr);
+			GLenum attachment = target->attachments[i]->glAttachment;
+			if (attachment == GL_DEPTH_ATTACHMENT)
+			{
+				if (depth)
+					attachments[count++] = attachment;
+			}
+			else if (attachment != GL_DEPTH_STENCIL_ATTACHMENT)
+			{
+				if (color)
+					attachments[count++] = attachment;
+			}
+			else if (depth && stencil)
+				attachments[count++] = GL_DEPTH_STENCIL_ATTACHMENT;
+			else if (depth)
+				attachments[count++] = GL_DEPTH_ATTACHMENT;
+			else if (stencil)
+				attachments[count++] = GL_STENCIL_ATTACHMENT;
 		}
 	}
+
+	if (count > 0)
+		fgl.glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments);
 }
 
 void FosterClear_OpenGL(FosterClearCommand* command)
 {
 	FosterBindFrameBuffer((FosterTarget_OpenGL*)command->target);
+
+	// discarding is all a clear command may be used for
+	FosterInvalidate_OpenGL((FosterTarget_OpenGL*)command->target, command->discard);
+	if (command->mask == FOSTER_CLEAR_MASK_NONE)
+		return;
+
 	FosterSetViewport(1, command->clip);
 	FosterSetScissor(0, fgl.stateScissor);
 
@@ -1795,6 +4184,8 @@ void FosterClear_OpenGL(FosterClearCommand* command)
 	{
 		clear |= GL_COLOR_BUFFER_BIT;
 		fgl.glColorMask(true, true, true, true);
+		fgl.stateBlend.mask = FOSTER_BLEND_MASK_R | FOSTER_BLEND_MASK_G | FOSTER_BLEND_MASK_B | FOSTER_BLEND_MASK_A;
+		fgl.statePipeline = NULL;
 		fgl.glClearColor(command->color.r / 255.0f, command->color.g / 255.0f, command->color.b / 255.0f, command->color.a / 255.0f);
 	}
 
@@ -1815,6 +4206,37 @@ void FosterClear_OpenGL(FosterClearCommand* command)
 	}
 
 	fgl.glClear(clear);
+	fgl.stats.clears++;
+}
+
+void FosterSubmitCommands_OpenGL(FosterCommand* commands, int count)
+{
+	FosterDrawCommand* last = NULL;
+	fgl.submitCount++;
+
+	for (int i = 0; i < count; i++)
+	{
+		FosterCommand* command = commands + i;
+
+		switch (command->type)
+		{
+			case FOSTER_COMMAND_TYPE_DRAW:
+				// consecutive draws usually share their render state, in which case
+				// there's no need to run through every state setter again
+				if (last == NULL || !FosterDrawStateEqual_OpenGL(last, &command->draw))
+					FosterDrawApplyState_OpenGL(&command->draw);
+				FosterDrawMesh_OpenGL(&command->draw);
+				last = &command->draw;
+				break;
+			case FOSTER_COMMAND_TYPE_CLEAR:
+				FosterClear_OpenGL(&command->clear);
+				last = NULL;
+				break;
+			default:
+				FOSTER_LOG_ERROR("Invalid Command Type (%i)", command->type);
+				break;
+		}
+	}
 }
 
 bool FosterGetDevice_OpenGL(FosterRenderDevice* device)
@@ -1827,26 +4249,51 @@ bool FosterGetDevice_OpenGL(FosterRenderDevice* device)
 	device->frameEnd = FosterFrameEnd_OpenGL;
 	device->getMaxTextureSize = FosterGetMaxTextureSize_OpenGL;
 	device->textureCreate = FosterTextureCreate_OpenGL;
+	device->textureCreateArray = FosterTextureCreateArray_OpenGL;
 	device->textureSetData = FosterTextureSetData_OpenGL;
+	device->textureSetLayerData = FosterTextureSetLayerData_OpenGL;
+	device->textureSetLevelData = FosterTextureSetLevelData_OpenGL;
+	device->textureGenerateMipmaps = FosterTextureGenerateMipmaps_OpenGL;
+	device->textureSetDataRect = FosterTextureSetDataRect_OpenGL;
+	device->textureSetDataAsync = FosterTextureSetDataAsync_OpenGL;
+	device->setUploadBudget = FosterSetUploadBudget_OpenGL;
+	device->getPendingUploadSize = FosterGetPendingUploadSize_OpenGL;
+	device->getFrameStats = FosterGetFrameStats_OpenGL;
 	device->textureGetData = FosterTextureGetData_OpenGL;
+	device->textureGetDataAsync = FosterTextureGetDataAsync_OpenGL;
+	device->readbackIsReady = FosterReadbackIsReady_OpenGL;
+	device->readbackGetData = FosterReadbackGetData_OpenGL;
+	device->readbackDestroy = FosterReadbackDestroy_OpenGL;
 	device->textureDestroy = FosterTextureDestroy_OpenGL;
 	device->targetCreate = FosterTargetCreate_OpenGL;
 	device->targetGetAttachment = FosterTargetGetAttachment_OpenGL;
+	device->targetResolve = FosterTargetResolve_OpenGL;
 	device->targetDestroy = FosterTargetDestroy_OpenGL;
 	device->shaderCreate = FosterShaderCreate_OpenGL;
+	device->shaderCreateAsync = FosterShaderCreateAsync_OpenGL;
+	device->shaderIsReady = FosterShaderIsReady_OpenGL;
 	device->shaderSetUniform = FosterShaderSetUniform_OpenGL;
 	device->shaderSetTexture = FosterShaderSetTexture_OpenGL;
 	device->shaderSetSampler = FosterShaderSetSampler_OpenGL;
+	device->shaderApplyUniforms = FosterShaderApplyUniforms_OpenGL;
 	device->shaderGetUniforms = FosterShaderGetUniforms_OpenGL;
 	device->shaderDestroy = FosterShaderDestroy_OpenGL;
+	device->pipelineCreate = FosterPipelineCreate_OpenGL;
+	device->pipelineDestroy = FosterPipelineDestroy_OpenGL;
 	device->meshCreate = FosterMeshCreate_OpenGL;
 	device->meshSetVertexFormat = FosterMeshSetVertexFormat_OpenGL;
 	device->meshSetVertexData = FosterMeshSetVertexData_OpenGL;
 	device->meshSetIndexFormat = FosterMeshSetIndexFormat_OpenGL;
 	device->meshSetIndexData = FosterMeshSetIndexData_OpenGL;
+	device->meshSetInstanceFormat = FosterMeshSetInstanceFormat_OpenGL;
+	device->meshSetInstanceData = FosterMeshSetInstanceData_OpenGL;
 	device->meshDestroy = FosterMeshDestroy_OpenGL;
+	device->transientAllocVertices = FosterTransientAllocVertices_OpenGL;
+	device->transientAllocIndices = FosterTransientAllocIndices_OpenGL;
+	device->transientAllocGeometry = FosterTransientAllocGeometry_OpenGL;
 	device->draw = FosterDraw_OpenGL;
 	device->clear = FosterClear_OpenGL;
+	device->submit = FosterSubmitCommands_OpenGL;
 	return true;
 }
 